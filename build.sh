@@ -113,6 +113,14 @@ if [ -d "$VCPKG_DIR" ]; then
     else
         log_info "gRPC 已安装，跳过安装"
     fi
+
+    # 进程内截图依赖 libavformat/libavcodec/libswscale
+    if ! ./vcpkg list | grep -q "^ffmpeg"; then
+        log_info "使用 vcpkg 安装 FFmpeg 开发库"
+        ./vcpkg install "ffmpeg[avcodec,avformat,swscale]"
+    else
+        log_info "FFmpeg 开发库已安装，跳过安装"
+    fi
     cd -
 else
     log_error "vcpkg 目录不存在: $VCPKG_DIR"
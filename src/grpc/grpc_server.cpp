@@ -1,6 +1,7 @@
 #include <grpcpp/grpcpp.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <memory>
 #include <regex>
 #include <string>
@@ -18,8 +19,14 @@ using edgeservice::CaptureRequest;
 using edgeservice::CaptureResponse;
 using edgeservice::GenPlayUrlRequest;
 using edgeservice::GenPlayUrlResponse;
+using edgeservice::GetHealthRequest;
+using edgeservice::GetHealthResponse;
 using edgeservice::GetResultRequest;
 using edgeservice::GetResultResponse;
+using edgeservice::GetStatsRequest;
+using edgeservice::GetStatsResponse;
+using edgeservice::GetVerdictRequest;
+using edgeservice::GetVerdictResponse;
 using grpc::Server;
 using grpc::ServerBuilder;
 using grpc::ServerContext;
@@ -28,19 +35,24 @@ using grpc::Status;
 class CameraServiceImpl final : public CameraService::Service {
   Status CaptureAndCheck(ServerContext *context, const CaptureRequest *request,
                          CaptureResponse *response) override {
+    CheckOptions opts;
+    opts.max_age_ms = std::max(0, request->max_age_ms());
     auto result = capture_and_check(static_cast<uint64_t>(request->camera_id()),
-                                    request->rtsp_url());
+                                    request->rtsp_url(), opts);
     response->set_code(result.value("code", 1));
     response->set_msg(result.value("msg", ""));
+    response->set_reused(result.value("reused", false));
+    response->set_hash_distance(result.value("hash_distance", 0));
     return Status::OK;
   }
 
   Status AsyncCaptureAndCheck(ServerContext *context,
                               const AsyncCaptureRequest *request,
                               AsyncCaptureResponse *response) override {
-    std::vector<std::pair<uint64_t, std::string>> cameras;
+    std::vector<InspectCamera> cameras;
     for (const auto &cam : request->cameras()) {
-      cameras.emplace_back(cam.camera_id(), cam.rtsp_url());
+      cameras.push_back(InspectCamera{cam.camera_id(), cam.rtsp_url(),
+                                      std::max(0, cam.max_age_ms())});
     }
     int timeout = request->timeout();
     nlohmann::json result;
@@ -48,6 +60,16 @@ class CameraServiceImpl final : public CameraService::Service {
     response->set_code(result.value("code", 1));
     response->set_msg(result.value("msg", ""));
     response->set_task_id(task_id);
+    response->set_queue_depth(result.value("queue_depth", uint64_t{0}));
+    response->set_projected_wait_ms(
+        result.value("projected_wait_ms", int64_t{0}));
+    // 队列或在途图片数据已满：RESOURCE_EXHAUSTED，重试建议放在 retry-after 元数据
+    if (result.value("code", 0) == 429) {
+      context->AddTrailingMetadata(
+          "retry-after", std::to_string(result.value("retry_after_sec", 1)));
+      return Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                    result.value("msg", ""));
+    }
     return Status::OK;
   }
 
@@ -115,6 +137,42 @@ class CameraServiceImpl final : public CameraService::Service {
     response->set_msg("");
     return Status::OK;
   }
+
+  Status GetLastVerdict(ServerContext *context,
+                        const GetVerdictRequest *request,
+                        GetVerdictResponse *response) override {
+    auto resp = get_last_verdict(request->camera_id());
+    response->set_code(resp.value("code", 1));
+    response->set_msg(resp.value("msg", ""));
+    response->set_camera_id(request->camera_id());
+    if (resp.contains("result")) {
+      response->set_verdict_json(resp["result"].dump());
+      response->set_age_ms(resp.value("age_ms", int64_t{0}));
+      response->set_stale(resp.value("stale", false));
+      response->set_refreshing(resp.value("refreshing", false));
+    }
+    return Status::OK;
+  }
+
+  Status GetCameraHealth(ServerContext *context,
+                         const GetHealthRequest *request,
+                         GetHealthResponse *response) override {
+    auto resp = get_camera_health(request->camera_id());
+    response->set_code(resp.value("code", 0));
+    response->set_msg(resp.value("msg", ""));
+    response->set_health_json(resp.dump());
+    return Status::OK;
+  }
+
+  Status GetInspectStats(ServerContext *context,
+                         const GetStatsRequest *request,
+                         GetStatsResponse *response) override {
+    auto stats = get_inspect_stats();
+    response->set_code(stats.value("code", 0));
+    response->set_msg(stats.value("msg", ""));
+    response->set_stats_json(stats.dump());
+    return Status::OK;
+  }
 };
 
 void RunGrpcServer(const std::string &address) {
@@ -65,7 +65,14 @@ void HttpServer::setup_routes() {
         res.set_content(resp.dump(), "application/json");
         return;
       }
-      resp = capture_and_check(camera_id, rtsp_url);
+      CheckOptions opts;
+      if (!parse_optional_ms(j, "max_age_ms", opts.max_age_ms, err_msg)) {
+        resp = {{"code", 1}, {"msg", err_msg}};
+        res.set_header("Access-Control-Allow-Origin", "*");
+        res.set_content(resp.dump(), "application/json");
+        return;
+      }
+      resp = capture_and_check(camera_id, rtsp_url, opts);
       res.set_header("Access-Control-Allow-Origin", "*");
       res.set_content(resp.dump(), "application/json");
     });
@@ -77,8 +84,17 @@ void HttpServer::setup_routes() {
       [](const httplib::Request &req, httplib::Response &res) {
         handle_json_post(req, res, [](const json &j, httplib::Response &res) {
           json resp;
-          std::vector<std::pair<uint64_t, std::string>> cameras;
+          std::vector<InspectCamera> cameras;
           int timeout_sec = 10;
+          // max_age_ms 可在请求级设置，单个摄像头可覆盖
+          int max_age_ms = 0;
+          std::string err_msg;
+          if (!parse_optional_ms(j, "max_age_ms", max_age_ms, err_msg)) {
+            resp = {{"code", 1}, {"msg", err_msg}};
+            res.set_header("Access-Control-Allow-Origin", "*");
+            res.set_content(resp.dump(), "application/json");
+            return;
+          }
           // timeout 必须为字符串且为纯数字
           if (j.contains("timeout")) {
             if (j["timeout"].is_string()) {
@@ -108,7 +124,6 @@ void HttpServer::setup_routes() {
                 return;
               }
               uint64_t camera_id = 0;
-              std::string err_msg;
               if (!parse_camera_id(cam, "camera_id", camera_id, err_msg)) {
                 resp = {{"code", 1}, {"msg", err_msg}};
                 res.set_header("Access-Control-Allow-Origin", "*");
@@ -130,12 +145,27 @@ void HttpServer::setup_routes() {
                 res.set_content(resp.dump(), "application/json");
                 return;
               }
-              cameras.emplace_back(camera_id, rtsp_url);
+              int cam_max_age_ms = max_age_ms;
+              if (!parse_optional_ms(cam, "max_age_ms", cam_max_age_ms,
+                                     err_msg)) {
+                resp = {{"code", 1}, {"msg", err_msg}};
+                res.set_header("Access-Control-Allow-Origin", "*");
+                res.set_content(resp.dump(), "application/json");
+                return;
+              }
+              cameras.push_back(
+                  InspectCamera{camera_id, rtsp_url, cam_max_age_ms});
             }
             json result;
             std::string task_id =
                 auto_inspect_async(cameras, timeout_sec, result);
             resp = result;
+            // 队列或在途图片数据已满：429 + Retry-After
+            if (result.value("code", 0) == 429) {
+              res.status = 429;
+              int retry_after = result.value("retry_after_sec", 1);
+              res.set_header("Retry-After", std::to_string(retry_after));
+            }
           } else {
             resp = {{"code", 1}, {"msg", "参数缺失或格式错误"}};
           }
@@ -175,6 +205,44 @@ void HttpServer::setup_routes() {
         res.set_content(result.dump(), "application/json");
       });
 
+  // 查询摄像头最近一次校验结论（过期时后台刷新）
+  server_.Get("/api/camera/last_verdict", [](const httplib::Request &req,
+                                             httplib::Response &res) {
+    json resp;
+    std::string id_str = req.get_param_value("camera_id");
+    if (!is_digits(id_str) || id_str.size() > 19) {
+      resp = {{"code", 1}, {"msg", "camera_id必须为数字"}};
+    } else {
+      resp = get_last_verdict(std::stoull(id_str));
+    }
+    res.set_header("Access-Control-Allow-Origin", "*");
+    res.set_content(resp.dump(), "application/json");
+  });
+
+  // 摄像头健康状况查询接口，不带 camera_id 时返回汇总
+  server_.Get("/api/camera/health", [](const httplib::Request &req,
+                                       httplib::Response &res) {
+    json resp;
+    std::string id_str = req.get_param_value("camera_id");
+    if (id_str.empty()) {
+      resp = get_camera_health(0);
+    } else if (!is_digits(id_str) || id_str.size() > 19) {
+      resp = {{"code", 1}, {"msg", "camera_id必须为数字"}};
+    } else {
+      resp = get_camera_health(std::stoull(id_str));
+    }
+    res.set_header("Access-Control-Allow-Origin", "*");
+    res.set_content(resp.dump(), "application/json");
+  });
+
+  // 巡检运行状态查询接口（常驻会话池等）
+  server_.Get("/api/inspect/stats",
+              [](const httplib::Request &, httplib::Response &res) {
+                json stats = get_inspect_stats();
+                res.set_header("Access-Control-Allow-Origin", "*");
+                res.set_content(stats.dump(), "application/json");
+              });
+
   // 生成播放地址接口（根据camera_id生成）
   server_.Post("/api/camera/gen_play_url", [](const httplib::Request &req,
                                               httplib::Response &res) {
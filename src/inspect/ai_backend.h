@@ -0,0 +1,39 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include "ai_client.h"
+
+// 一次AI校验请求的请求体：head、image、tail 依次拼接，空的部分跳过。
+// 由 shared_ptr 共享，对冲请求的两份副本都结束后才释放。
+// gRPC 后端只发送 image（截图原始字节），head、tail 为空
+struct AiRequest {
+  std::string content_type;
+  std::string head;  // 图片前的数据，base64_json 模式下即整个请求体
+  std::vector<uint8_t> image;
+  std::string tail;
+
+  std::vector<AiClient::BodyPart> parts() const;
+};
+
+// AI校验后端：REST（AiBalancer，每张图片一次HTTP POST，支持多副本）或
+// gRPC（AiGrpcBackend，全部校验复用一条双向流）。实现须线程安全
+class AiBackend {
+ public:
+  virtual ~AiBackend() = default;
+
+  // 发送请求并返回AI服务的结果，失败时返回 {"code":500/408, "msg":...}
+  virtual nlohmann::json post(
+      std::shared_ptr<const AiRequest> req,
+      std::chrono::steady_clock::time_point deadline) = 0;
+
+  // 对AI服务的最大并发请求数，作为AI并发上限与校验阶段线程数
+  virtual size_t max_concurrency() const = 0;
+
+  // 连接与请求统计，导出为巡检状态中的 ai_client
+  virtual nlohmann::json stats() = 0;
+};
@@ -0,0 +1,306 @@
+#include "ai_balancer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+std::vector<AiClient::BodyPart> AiRequest::parts() const {
+  std::vector<AiClient::BodyPart> parts;
+  if (!head.empty()) parts.push_back({head.data(), head.size()});
+  if (!image.empty()) {
+    parts.push_back(
+        {reinterpret_cast<const char *>(image.data()), image.size()});
+  }
+  if (!tail.empty()) parts.push_back({tail.data(), tail.size()});
+  return parts;
+}
+
+// 传输层失败（连接失败、HTTP错误、非JSON、超时），不含AI业务错误码
+static bool is_transport_error(const json &result, bool &timed_out) {
+  timed_out = false;
+  if (!result.is_object() || !result.contains("code") ||
+      !result["code"].is_number_integer()) {
+    return false;
+  }
+  int code = result["code"].get<int>();
+  timed_out = code == 408;
+  return code == 500 || code == 408;
+}
+
+static std::string endpoint_name(const AiClient::Options &opts) {
+  return opts.host + ":" + std::to_string(opts.port);
+}
+
+// 对冲中的一次请求：原请求与对冲请求共享，取先成功的结果
+struct AiBalancer::Hedge {
+  std::mutex mutex;
+  std::condition_variable cv;
+  int pending = 0;  // 尚未返回的副本数
+  bool done = false;
+  bool hedge_won = false;
+  json result;
+};
+
+AiBalancer::AiBalancer(const Options &opts) : opts_(opts) {
+  if (opts_.endpoints.empty()) opts_.endpoints.emplace_back();
+  if (opts_.latency_samples == 0) opts_.latency_samples = 1;
+  size_t connections = 0;
+  endpoints_.resize(opts_.endpoints.size());
+  for (size_t i = 0; i < opts_.endpoints.size(); ++i) {
+    endpoints_[i].client = std::make_unique<AiClient>(opts_.endpoints[i]);
+    connections += endpoints_[i].client->options().pool_size;
+  }
+  if (opts_.hedge && endpoints_.size() > 1) {
+    // 原请求与对冲请求都在该线程池中执行，调用线程只等待先到的结果；
+    // 线程数按全部连接数的两倍，保证原请求不必排队
+    PipelineStage::Options pool;
+    pool.name = "ai_hedge";
+    pool.concurrency = connections * 2;
+    pool.max_queue = connections * 2;
+    hedge_pool_ = std::make_unique<PipelineStage>(pool);
+  }
+  if (!opts_.health_path.empty() && endpoints_.size() > 1) {
+    health_thread_ = std::thread([this]() { health_loop(); });
+  }
+  spdlog::info("AI服务副本{}个，对冲{}，健康检查{}", endpoints_.size(),
+               hedge_pool_ ? "开启" : "关闭",
+               health_thread_.joinable() ? opts_.health_path : "关闭");
+}
+
+AiBalancer::~AiBalancer() {
+  {
+    std::lock_guard<std::mutex> lock(health_mutex_);
+    exit_ = true;
+  }
+  health_cv_.notify_all();
+  if (health_thread_.joinable()) health_thread_.join();
+  hedge_pool_.reset();
+}
+
+// 选择在途请求最少的健康副本，相同时轮转；选中即计入在途。
+// 没有健康副本时，原请求仍发往在途最少的副本，对冲请求则放弃
+AiBalancer::Endpoint *AiBalancer::pick_locked(const Endpoint *exclude) {
+  auto now = Clock::now();
+  size_t n = endpoints_.size();
+  Endpoint *best = nullptr;
+  Endpoint *fallback = nullptr;
+  for (size_t k = 0; k < n; ++k) {
+    Endpoint &ep = endpoints_[(next_ + k) % n];
+    if (&ep == exclude) continue;
+    if (!ep.healthy && opts_.health_path.empty() && now >= ep.retry_at) {
+      // 冷却期已过：用这一次请求试探，结束前其余请求仍避开它
+      ep.retry_at = now + std::chrono::milliseconds(opts_.cooldown_ms);
+      best = &ep;
+      break;
+    }
+    if (!fallback || ep.outstanding < fallback->outstanding) fallback = &ep;
+    if (ep.healthy && (!best || ep.outstanding < best->outstanding)) {
+      best = &ep;
+    }
+  }
+  if (!best && !exclude) best = fallback;
+  if (!best) return nullptr;
+  ++best->outstanding;
+  next_ = (static_cast<size_t>(best - endpoints_.data()) + 1) % n;
+  return best;
+}
+
+size_t AiBalancer::max_concurrency() const {
+  size_t connections = 0;
+  for (const auto &ep : endpoints_) {
+    connections += ep.client->options().pool_size;
+  }
+  return connections;
+}
+
+json AiBalancer::send(Endpoint *ep, const AiRequest &req,
+                      Clock::time_point deadline) {
+  auto start = Clock::now();
+  json result = ep->client->post(req.parts(), req.content_type, deadline);
+  auto now = Clock::now();
+  bool timed_out = false;
+  bool failed = is_transport_error(result, timed_out);
+  std::lock_guard<std::mutex> lock(mutex_);
+  --ep->outstanding;
+  ++ep->requests;
+  if (failed && !timed_out) {
+    ++ep->failures;
+    if (++ep->consecutive_failures >= opts_.fail_threshold && ep->healthy) {
+      ep->healthy = false;
+      ep->retry_at = now + std::chrono::milliseconds(opts_.cooldown_ms);
+      spdlog::warn("AI服务副本{}连续失败{}次，暂时摘除",
+                   endpoint_name(ep->client->options()),
+                   ep->consecutive_failures);
+    }
+  } else if (!failed) {
+    ep->consecutive_failures = 0;
+    if (!ep->healthy) {
+      ep->healthy = true;
+      spdlog::info("AI服务副本{}恢复", endpoint_name(ep->client->options()));
+    }
+    float ms = std::chrono::duration<float, std::milli>(now - start).count();
+    if (latencies_.size() < opts_.latency_samples) {
+      latencies_.push_back(ms);
+    } else {
+      latencies_[latency_next_] = ms;
+      latency_next_ = (latency_next_ + 1) % latencies_.size();
+    }
+  }
+  return result;
+}
+
+bool AiBalancer::hedge_delay_locked(std::chrono::milliseconds &delay) const {
+  if (latencies_.size() < std::max<size_t>(opts_.min_samples, 1)) return false;
+  std::vector<float> v = latencies_;
+  size_t k = std::min(v.size() - 1,
+                      static_cast<size_t>(opts_.hedge_percentile * v.size()));
+  std::nth_element(v.begin(), v.begin() + k, v.end());
+  delay = std::max(std::chrono::milliseconds(opts_.hedge_min_delay_ms),
+                   std::chrono::milliseconds(static_cast<int64_t>(v[k])));
+  return true;
+}
+
+void AiBalancer::launch(Endpoint *ep,
+                        const std::shared_ptr<const AiRequest> &req,
+                        Clock::time_point deadline,
+                        const std::shared_ptr<Hedge> &hedge, bool is_hedge) {
+  {
+    std::lock_guard<std::mutex> lock(hedge->mutex);
+    ++hedge->pending;
+  }
+  hedge_pool_->submit(
+      [this, ep, req, deadline, hedge, is_hedge]() {
+        json result = send(ep, *req, deadline);
+        bool timed_out = false;
+        bool ok = !is_transport_error(result, timed_out);
+        std::lock_guard<std::mutex> lock(hedge->mutex);
+        --hedge->pending;
+        // 失败的结果只有在另一份也结束时才采用
+        if (hedge->done || (!ok && hedge->pending > 0)) return;
+        hedge->done = true;
+        hedge->hedge_won = is_hedge && ok;
+        hedge->result = std::move(result);
+        hedge->cv.notify_all();
+      },
+      true);
+}
+
+json AiBalancer::post(std::shared_ptr<const AiRequest> req,
+                      Clock::time_point deadline) {
+  Endpoint *primary = nullptr;
+  auto delay = std::chrono::milliseconds(0);
+  bool hedge = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    primary = pick_locked(nullptr);
+    hedge = hedge_pool_ && hedge_delay_locked(delay);
+  }
+  if (!hedge) return send(primary, *req, deadline);
+
+  auto state = std::make_shared<Hedge>();
+  launch(primary, req, deadline, state, false);
+  auto hedge_at = std::min(deadline, Clock::now() + delay);
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    if (state->cv.wait_until(lock, hedge_at, [&] { return state->done; })) {
+      return std::move(state->result);
+    }
+  }
+  Endpoint *second = nullptr;
+  if (Clock::now() < deadline) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    second = pick_locked(primary);
+    if (second) {
+      ++second->hedges;
+      ++hedged_;
+    }
+  }
+  if (second) launch(second, req, deadline, state, true);
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->cv.wait(lock, [&] { return state->done; });
+  if (state->hedge_won) {
+    std::lock_guard<std::mutex> stats_lock(mutex_);
+    ++second->hedge_wins;
+    ++hedge_wins_;
+  }
+  return std::move(state->result);
+}
+
+void AiBalancer::health_loop() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(health_mutex_);
+      if (health_cv_.wait_for(
+              lock, std::chrono::milliseconds(opts_.health_interval_ms),
+              [this] { return exit_; })) {
+        break;
+      }
+    }
+    for (size_t i = 0; i < endpoints_.size(); ++i) {
+      const AiClient::Options &o = opts_.endpoints[i];
+      httplib::Client cli((o.tls ? "https://" : "http://") + o.host + ":" +
+                          std::to_string(o.port));
+#ifdef CPPHTTPLIB_OPENSSL_SUPPORT
+      if (o.tls) cli.enable_server_certificate_verification(o.tls_verify);
+#endif
+      auto timeout = std::chrono::milliseconds(
+          std::min(o.connect_timeout_ms, opts_.health_interval_ms));
+      cli.set_connection_timeout(timeout);
+      cli.set_read_timeout(timeout);
+      auto res = cli.Get(opts_.health_path);
+      bool ok = res && res->status == 200;
+      std::lock_guard<std::mutex> lock(mutex_);
+      Endpoint &ep = endpoints_[i];
+      if (ok && !ep.healthy) {
+        ep.healthy = true;
+        ep.consecutive_failures = 0;
+        spdlog::info("AI服务副本{}健康检查通过，恢复", endpoint_name(o));
+      } else if (!ok && ep.healthy) {
+        ep.healthy = false;
+        spdlog::warn("AI服务副本{}健康检查失败，暂时摘除", endpoint_name(o));
+      }
+    }
+  }
+}
+
+json AiBalancer::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // 顶层为全部副本连接池的合计，字段与单个 AiClient 一致
+  json total = json::object();
+  json endpoints = json::array();
+  double wait_ms_total = 0;
+  for (auto &ep : endpoints_) {
+    json pool = ep.client->stats();
+    for (auto &[key, value] : pool.items()) {
+      if (!value.is_number_unsigned()) continue;
+      total[key] = total.value(key, static_cast<uint64_t>(0)) +
+                   value.get<uint64_t>();
+    }
+    wait_ms_total += pool.value("avg_wait_ms", 0.0) *
+                     pool.value("waits", static_cast<uint64_t>(0));
+    endpoints.push_back({{"endpoint", endpoint_name(ep.client->options())},
+                         {"healthy", ep.healthy},
+                         {"outstanding", ep.outstanding},
+                         {"requests", ep.requests},
+                         {"failures", ep.failures},
+                         {"hedges", ep.hedges},
+                         {"hedge_wins", ep.hedge_wins},
+                         {"pool", pool}});
+  }
+  uint64_t waits = total.value("waits", static_cast<uint64_t>(0));
+  total["avg_wait_ms"] = waits ? wait_ms_total / waits : 0.0;
+  if (endpoints_.size() > 1) {
+    auto delay = std::chrono::milliseconds(0);
+    bool ready = hedge_pool_ && hedge_delay_locked(delay);
+    total["endpoints"] = endpoints;
+    total["hedge"] = {{"enabled", hedge_pool_ != nullptr},
+                      {"delay_ms", ready ? delay.count() : 0},
+                      {"latency_samples", latencies_.size()},
+                      {"hedged", hedged_},
+                      {"hedge_wins", hedge_wins_}};
+  }
+  return total;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ai_backend.h"
+#include "ai_client.h"
+#include "pipeline_stage.h"
+
+// REST后端，多副本AI服务：每个副本一个 AiClient（各自的连接池），请求发往在途
+// 请求最少的健康副本。连续失败的副本摘除，配置了健康检查路径时由后台
+// 定期探测恢复，否则冷却期过后重新参与选择。开启对冲时，请求超过近期
+// 延迟分位数（默认 p95）仍未返回，就向另一副本再发一份，取先成功的结果。
+class AiBalancer : public AiBackend {
+ public:
+  struct Options {
+    std::vector<AiClient::Options> endpoints;
+    int fail_threshold = 3;           // 连续失败达到该次数摘除副本
+    int cooldown_ms = 10000;          // 无健康检查时，摘除后重新尝试的间隔
+    std::string health_path;          // 健康检查路径，空表示不主动探测
+    int health_interval_ms = 5000;    // 健康检查间隔
+    bool hedge = false;               // 是否开启对冲请求
+    double hedge_percentile = 0.95;   // 超过该延迟分位数仍未返回时对冲
+    int hedge_min_delay_ms = 50;      // 对冲等待时间下限
+    size_t latency_samples = 256;     // 延迟分位数的样本窗口
+    size_t min_samples = 20;          // 样本数达到该值才开始对冲
+  };
+
+  explicit AiBalancer(const Options &opts);
+  ~AiBalancer();
+  AiBalancer(const AiBalancer &) = delete;
+  AiBalancer &operator=(const AiBalancer &) = delete;
+
+  nlohmann::json post(std::shared_ptr<const AiRequest> req,
+                      std::chrono::steady_clock::time_point deadline) override;
+
+  // 全部副本的连接数之和
+  size_t max_concurrency() const override;
+
+  // 各副本的健康状况、在途请求数、延迟分位数与连接池状态，以及对冲统计
+  nlohmann::json stats() override;
+
+ private:
+  struct Endpoint {
+    std::unique_ptr<AiClient> client;
+    size_t outstanding = 0;
+    bool healthy = true;
+    int consecutive_failures = 0;
+    std::chrono::steady_clock::time_point retry_at;  // 摘除后重新尝试的时间
+    uint64_t requests = 0;
+    uint64_t failures = 0;
+    uint64_t hedges = 0;      // 作为对冲副本收到的请求数
+    uint64_t hedge_wins = 0;  // 对冲请求先于原请求返回的次数
+  };
+  struct Hedge;
+
+  Endpoint *pick_locked(const Endpoint *exclude);
+  nlohmann::json send(Endpoint *ep, const AiRequest &req,
+                      std::chrono::steady_clock::time_point deadline);
+  void launch(Endpoint *ep, const std::shared_ptr<const AiRequest> &req,
+              std::chrono::steady_clock::time_point deadline,
+              const std::shared_ptr<Hedge> &hedge, bool is_hedge);
+  bool hedge_delay_locked(std::chrono::milliseconds &delay) const;
+  void health_loop();
+
+  Options opts_;
+  std::mutex mutex_;
+  std::vector<Endpoint> endpoints_;
+  size_t next_ = 0;             // 在途数相同时轮转选择的起点
+  std::vector<float> latencies_;  // 成功请求延迟，环形缓冲
+  size_t latency_next_ = 0;
+  uint64_t hedged_ = 0;
+  uint64_t hedge_wins_ = 0;
+  std::unique_ptr<PipelineStage> hedge_pool_;  // 开启对冲时执行请求
+
+  std::mutex health_mutex_;
+  std::condition_variable health_cv_;
+  bool exit_ = false;
+  std::thread health_thread_;
+};
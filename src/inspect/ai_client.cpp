@@ -0,0 +1,212 @@
+#include "ai_client.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+#ifdef CPPHTTPLIB_OPENSSL_SUPPORT
+// TLS会话复用：新会话回调保存服务端下发的会话，下一次握手开始前设置到
+// 新连接上。httplib 没有暴露握手前的钩子，这里借助 SSL_CTX 的 info 回调。
+struct AiTlsSessionCache {
+  static int ex_index() {
+    static int idx =
+        SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+    return idx;
+  }
+
+  static AiClient *owner(const SSL *ssl) {
+    return static_cast<AiClient *>(
+        SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), ex_index()));
+  }
+
+  static int on_new_session(SSL *ssl, SSL_SESSION *sess) {
+    AiClient *cli = owner(ssl);
+    if (!cli) return 0;
+    std::lock_guard<std::mutex> lock(cli->tls_mutex_);
+    if (cli->tls_session_) SSL_SESSION_free(cli->tls_session_);
+    cli->tls_session_ = sess;
+    return 1;  // 返回1表示由我们持有该会话的引用
+  }
+
+  static void on_info(const SSL *ssl, int where, int) {
+    AiClient *cli = owner(ssl);
+    if (!cli) return;
+    SSL *s = const_cast<SSL *>(ssl);
+    std::lock_guard<std::mutex> lock(cli->tls_mutex_);
+    if ((where & SSL_CB_HANDSHAKE_START) && SSL_in_before(s) &&
+        cli->tls_session_ && SSL_SESSION_is_resumable(cli->tls_session_)) {
+      SSL_set_session(s, cli->tls_session_);
+    } else if ((where & SSL_CB_HANDSHAKE_DONE) && SSL_session_reused(s)) {
+      ++cli->tls_resumed_;
+    }
+  }
+
+  static void install(SSL_CTX *ctx, AiClient *cli) {
+    SSL_CTX_set_ex_data(ctx, ex_index(), cli);
+    SSL_CTX_set_session_cache_mode(
+        ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ctx, &AiTlsSessionCache::on_new_session);
+    SSL_CTX_set_info_callback(ctx, &AiTlsSessionCache::on_info);
+  }
+};
+#endif
+
+AiClient::AiClient(const Options &opts) : opts_(opts) {
+  if (opts_.pool_size == 0) opts_.pool_size = 1;
+  spdlog::info("AI客户端: {}://{}:{}{}，连接池{}", opts_.tls ? "https" : "http",
+               opts_.host, opts_.port, opts_.path, opts_.pool_size);
+}
+
+AiClient::~AiClient() {
+  idle_.clear();
+#ifdef CPPHTTPLIB_OPENSSL_SUPPORT
+  if (tls_session_) SSL_SESSION_free(tls_session_);
+#endif
+}
+
+std::unique_ptr<httplib::Client> AiClient::make_client() {
+  std::string scheme = opts_.tls ? "https://" : "http://";
+  auto cli = std::make_unique<httplib::Client>(
+      scheme + opts_.host + ":" + std::to_string(opts_.port));
+  cli->set_keep_alive(true);
+#ifdef CPPHTTPLIB_OPENSSL_SUPPORT
+  if (opts_.tls) {
+    cli->enable_server_certificate_verification(opts_.tls_verify);
+    if (opts_.tls_session_resumption && cli->ssl_context()) {
+      AiTlsSessionCache::install(cli->ssl_context(), this);
+    }
+  }
+#endif
+  return cli;
+}
+
+std::unique_ptr<httplib::Client> AiClient::acquire(
+    Clock::time_point deadline) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (idle_.empty() && created_ >= opts_.pool_size) {
+    auto start = Clock::now();
+    ++waits_;
+    auto ready = [this] {
+      return !idle_.empty() || created_ < opts_.pool_size;
+    };
+    if (deadline == Clock::time_point::max()) {
+      cv_.wait(lock, ready);
+    } else if (!cv_.wait_until(lock, deadline, ready)) {
+      ++acquire_timeouts_;
+      return nullptr;
+    }
+    wait_us_total_ += std::chrono::duration_cast<std::chrono::microseconds>(
+                          Clock::now() - start)
+                          .count();
+  }
+  std::unique_ptr<httplib::Client> cli;
+  if (!idle_.empty()) {
+    cli = std::move(idle_.back());
+    idle_.pop_back();
+  } else {
+    ++created_;
+    cli = make_client();
+  }
+  ++in_use_;
+  peak_in_use_ = std::max(peak_in_use_, in_use_);
+  return cli;
+}
+
+void AiClient::release(std::unique_ptr<httplib::Client> cli) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --in_use_;
+    idle_.push_back(std::move(cli));
+  }
+  cv_.notify_one();
+}
+
+json AiClient::post(const char *body, size_t size,
+                    const std::string &content_type,
+                    Clock::time_point deadline) {
+  return post(std::vector<BodyPart>{{body, size}}, content_type, deadline);
+}
+
+json AiClient::post(const std::vector<BodyPart> &parts,
+                    const std::string &content_type,
+                    Clock::time_point deadline) {
+  auto connect_timeout = std::chrono::milliseconds(opts_.connect_timeout_ms);
+  auto read_timeout = std::chrono::milliseconds(opts_.read_timeout_ms);
+  bool bounded = deadline != Clock::time_point::max();
+  if (bounded && Clock::now() >= deadline) {
+    return json{{"code", 408}, {"msg", "AI校验超时"}};
+  }
+  auto cli = acquire(deadline);
+  if (!cli) return json{{"code", 408}, {"msg", "等待AI服务连接超时"}};
+  auto max_timeout = std::chrono::milliseconds(0);  // 0表示不限
+  if (bounded) {
+    // 连接/读超时不超过剩余时间
+    max_timeout = std::max(
+        std::chrono::milliseconds(1),
+        std::chrono::duration_cast<std::chrono::milliseconds>(deadline -
+                                                              Clock::now()));
+    connect_timeout = std::min(connect_timeout, max_timeout);
+    read_timeout = std::min(read_timeout, max_timeout);
+  }
+  cli->set_connection_timeout(connect_timeout);
+  cli->set_read_timeout(read_timeout);
+  cli->set_write_timeout(read_timeout);
+  cli->set_max_timeout(max_timeout);
+  size_t total = 0;
+  for (const auto &p : parts) total += p.size;
+  // httplib按 offset 依次索取数据，定位到所在分段后直接写出
+  auto provider = [&parts](size_t offset, size_t length,
+                           httplib::DataSink &sink) {
+    size_t base = 0;
+    for (const auto &p : parts) {
+      if (offset < base + p.size) {
+        size_t off = offset - base;
+        return sink.write(p.data + off, std::min(length, p.size - off));
+      }
+      base += p.size;
+    }
+    return false;
+  };
+  auto res = cli->Post(opts_.path, total, provider, content_type);
+  json result;
+  bool ok = false;
+  if (res && (res->status == 200 || res->status == 400)) {
+    result = json::parse(res->body, nullptr, false);
+    ok = !result.is_discarded();
+    if (!ok) result = json{{"code", 500}, {"msg", "AI服务返回非JSON内容"}};
+  } else if (bounded && Clock::now() >= deadline) {
+    result = json{{"code", 408}, {"msg", "AI校验超时"}};
+  } else {
+    result = json{{"code", 500}, {"msg", "AI服务请求失败"}};
+  }
+  release(std::move(cli));
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++requests_;
+  if (!ok) ++failures_;
+  return result;
+}
+
+json AiClient::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  json s = {{"pool_size", opts_.pool_size},
+            {"connections", created_},
+            {"in_use", in_use_},
+            {"peak_in_use", peak_in_use_},
+            {"requests", requests_},
+            {"failures", failures_},
+            {"waits", waits_},
+            {"avg_wait_ms",
+             waits_ ? static_cast<double>(wait_us_total_) / waits_ / 1000.0
+                    : 0.0},
+            {"acquire_timeouts", acquire_timeouts_}};
+#ifdef CPPHTTPLIB_OPENSSL_SUPPORT
+  if (opts_.tls) {
+    std::lock_guard<std::mutex> tls_lock(tls_mutex_);
+    s["tls_resumed"] = tls_resumed_;
+  }
+#endif
+  return s;
+}
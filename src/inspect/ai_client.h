@@ -0,0 +1,82 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include "3rdparty/include/cpp-httplib/httplib.h"
+
+// AI校验服务客户端：进程内长期存在、线程安全，维护一组 keep-alive 连接，
+// 每次请求从池中借出一个连接，用完归还，避免每张图片都重新 TCP（及TLS）握手。
+// 开启TLS时可复用上一次握手得到的会话票据（session resumption）。
+class AiClient {
+ public:
+  struct Options {
+    std::string host = "124.70.8.249";
+    int port = 1055;
+    std::string path = "/v1/eyes/exists";
+    bool tls = false;
+    bool tls_verify = true;             // 校验服务端证书
+    bool tls_session_resumption = true;  // 重连时复用TLS会话
+    int connect_timeout_ms = 3000;
+    int read_timeout_ms = 30000;
+    size_t pool_size = 16;  // 连接池上限，即对AI服务的最大并发请求数
+  };
+
+  explicit AiClient(const Options &opts);
+  ~AiClient();
+  AiClient(const AiClient &) = delete;
+  AiClient &operator=(const AiClient &) = delete;
+
+  // 请求体中的一段数据，由调用方持有，post返回前须保持有效
+  struct BodyPart {
+    const char *data;
+    size_t size;
+  };
+
+  // POST body 到 AI 服务；连接、等待空闲连接、读写都不超过 deadline。
+  // 返回 AI 服务的 JSON 结果，失败时返回 {"code":500/408, "msg":...}
+  nlohmann::json post(const char *body, size_t size,
+                      const std::string &content_type,
+                      std::chrono::steady_clock::time_point deadline);
+
+  // 同上，请求体由多段按顺序拼接，直接从各段缓冲写入socket，不再合并拷贝
+  nlohmann::json post(const std::vector<BodyPart> &parts,
+                      const std::string &content_type,
+                      std::chrono::steady_clock::time_point deadline);
+
+  // 连接池利用率：池大小、借出数、峰值、等待次数与平均等待时间等
+  nlohmann::json stats();
+
+  const Options &options() const { return opts_; }
+
+ private:
+  std::unique_ptr<httplib::Client> make_client();
+  std::unique_ptr<httplib::Client> acquire(
+      std::chrono::steady_clock::time_point deadline);
+  void release(std::unique_ptr<httplib::Client> cli);
+
+  Options opts_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<std::unique_ptr<httplib::Client>> idle_;
+  size_t created_ = 0;
+  size_t in_use_ = 0;
+  size_t peak_in_use_ = 0;
+  uint64_t requests_ = 0;
+  uint64_t failures_ = 0;
+  uint64_t waits_ = 0;  // 借连接时池已满、需要排队的次数
+  uint64_t wait_us_total_ = 0;
+  uint64_t acquire_timeouts_ = 0;
+
+#ifdef CPPHTTPLIB_OPENSSL_SUPPORT
+  friend struct AiTlsSessionCache;
+  std::mutex tls_mutex_;
+  SSL_SESSION *tls_session_ = nullptr;  // 最近一次握手得到的会话
+  uint64_t tls_resumed_ = 0;
+#endif
+};
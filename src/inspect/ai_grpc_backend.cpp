@@ -0,0 +1,255 @@
+#include "ai_grpc_backend.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+AiGrpcBackend::AiGrpcBackend(const Options &opts) : opts_(opts) {
+  if (opts_.max_inflight == 0) opts_.max_inflight = 1;
+  grpc::ChannelArguments args;
+  if (opts_.keepalive_ms > 0) {
+    args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, opts_.keepalive_ms);
+    args.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, opts_.keepalive_ms);
+    args.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+  }
+  args.SetMaxReceiveMessageSize(-1);
+  auto creds = opts_.tls ? grpc::SslCredentials(grpc::SslCredentialsOptions())
+                         : grpc::InsecureChannelCredentials();
+  channel_ = grpc::CreateCustomChannel(opts_.target, creds, args);
+  stub_ = edgeservice::InferenceService::NewStub(channel_);
+  watchdog_ = std::thread([this]() { watchdog_loop(); });
+  spdlog::info("AI gRPC后端: {}{}，最大在途请求{}", opts_.target,
+               opts_.tls ? "（TLS）" : "", opts_.max_inflight);
+}
+
+AiGrpcBackend::~AiGrpcBackend() {
+  std::shared_ptr<Stream> stream;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exit_ = true;
+    stream = stream_;
+  }
+  watchdog_cv_.notify_all();
+  if (watchdog_.joinable()) watchdog_.join();
+  if (stream) {
+    stream->ctx.TryCancel();
+    if (stream->reader.joinable()) stream->reader.join();
+  }
+}
+
+// 返回可用的流，没有时建立新流；连接失败后的冷却期内、或等待连接超过
+// 剩余时间时返回 nullptr。等待连接与建流都在锁外进行，推理服务不可达时
+// 各调用方按自己的截止时间等待，不会排在别人的连接超时之后；多个调用方
+// 同时建流时先发布者胜出，其余取消自己建的流并改用它
+std::shared_ptr<AiGrpcBackend::Stream> AiGrpcBackend::acquire_stream(
+    Clock::time_point deadline) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stream_ && !stream_->broken) return stream_;
+    if (exit_ || Clock::now() < reconnect_at_) return nullptr;
+  }
+  auto connect_by =
+      Clock::now() + std::chrono::milliseconds(opts_.connect_timeout_ms);
+  bool by_deadline = deadline < connect_by;
+  connect_by = std::min(connect_by, deadline);
+  // gRPC 的等待只接受 system_clock 时间点
+  auto wait_until = std::chrono::system_clock::now() +
+                    std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                        connect_by - Clock::now());
+  if (!channel_->WaitForConnected(wait_until)) {
+    // 调用方剩余时间不足导致的超时不代表推理服务不可用，不进入冷却
+    if (!by_deadline) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (Clock::now() >= reconnect_at_) {
+        reconnect_at_ = Clock::now() +
+                        std::chrono::milliseconds(opts_.reconnect_backoff_ms);
+        ++stream_failures_;
+        spdlog::warn("AI gRPC后端连接{}失败", opts_.target);
+      }
+    }
+    return nullptr;
+  }
+  auto stream = std::make_shared<Stream>();
+  stream->rw = stub_->Verify(&stream->ctx);
+  std::shared_ptr<Stream> old;
+  std::shared_ptr<Stream> winner;
+  bool published = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (exit_ || (stream_ && !stream_->broken)) {
+      winner = stream_;
+    } else {
+      old = std::move(stream_);
+      stream_ = stream;
+      ++streams_opened_;
+      published = true;
+      stream->writer = std::thread([this, stream]() { write_loop(stream); });
+      stream->reader = std::thread([this, stream]() { read_loop(stream); });
+    }
+  }
+  if (!published) {
+    stream->ctx.TryCancel();
+    stream->rw->Finish();
+    return winner;
+  }
+  // 旧流已中断，读线程（及其回收的写线程）已退出或即将退出
+  if (old && old->reader.joinable()) old->reader.join();
+  return stream;
+}
+
+// 依次写出发送队列中的请求，跳过调用方已超时放弃的；流中断即退出
+void AiGrpcBackend::write_loop(const std::shared_ptr<Stream> &stream) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    stream->outbox_cv.wait(lock, [&stream] {
+      return stream->broken || !stream->outbox.empty();
+    });
+    if (stream->broken) break;
+    Outgoing out = std::move(stream->outbox.front());
+    stream->outbox.pop_front();
+    if (stream->pending.count(out.id) == 0) continue;
+    stream->writing = true;
+    stream->write_started = Clock::now();
+    lock.unlock();
+    edgeservice::VerifyRequest msg;
+    msg.set_request_id(out.id);
+    msg.set_content_type(out.req->content_type);
+    msg.set_image(out.req->image.data(), out.req->image.size());
+    bool ok = stream->rw->Write(msg);
+    lock.lock();
+    stream->writing = false;
+    if (!ok) break;  // 流已中断，由读线程收尾
+  }
+  stream->outbox.clear();
+}
+
+// 看门狗：写线程在一次 Write 中阻塞超过 write_timeout_ms 时取消整条流，
+// 在途请求随即失败，下一次请求重新建流
+void AiGrpcBackend::watchdog_loop() {
+  auto timeout = std::chrono::milliseconds(std::max(1, opts_.write_timeout_ms));
+  auto interval = std::max(std::chrono::milliseconds(10), timeout / 4);
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!exit_) {
+    watchdog_cv_.wait_for(lock, interval);
+    if (exit_) break;
+    Stream *s = stream_.get();
+    if (s && s->writing && !s->broken && !s->cancelled &&
+        Clock::now() - s->write_started > timeout) {
+      s->cancelled = true;
+      ++write_stalls_;
+      spdlog::warn("AI gRPC后端写入停滞超过{}毫秒，取消当前流",
+                   opts_.write_timeout_ms);
+      s->ctx.TryCancel();
+    }
+  }
+}
+
+void AiGrpcBackend::read_loop(const std::shared_ptr<Stream> &stream) {
+  edgeservice::VerifyResponse resp;
+  while (stream->rw->Read(&resp)) {
+    json result = json::parse(resp.result_json(), nullptr, false);
+    if (result.is_discarded()) {
+      result = json{{"code", 500}, {"msg", "AI服务返回非JSON内容"}};
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = stream->pending.find(resp.request_id());
+    if (it == stream->pending.end()) continue;  // 调用方已超时放弃
+    it->second.set_value(std::move(result));
+    stream->pending.erase(it);
+  }
+  // 先停写线程：Finish 不能与 Write 并发。读端结束说明流已终止，
+  // 阻塞中的 Write 也会随之返回
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stream->broken = true;
+  }
+  stream->outbox_cv.notify_all();
+  if (stream->writer.joinable()) stream->writer.join();
+  grpc::Status status = stream->rw->Finish();
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &item : stream->pending) {
+    item.second.set_value(json{{"code", 500}, {"msg", "AI服务gRPC流中断"}});
+  }
+  stream->pending.clear();
+  if (exit_) return;
+  ++stream_failures_;
+  reconnect_at_ =
+      Clock::now() + std::chrono::milliseconds(opts_.reconnect_backoff_ms);
+  spdlog::warn("AI gRPC后端流中断: {} {}",
+               static_cast<int>(status.error_code()), status.error_message());
+}
+
+json AiGrpcBackend::post(std::shared_ptr<const AiRequest> req,
+                         Clock::time_point deadline) {
+  bool bounded = deadline != Clock::time_point::max();
+  if (bounded && Clock::now() >= deadline) {
+    return json{{"code", 408}, {"msg", "AI校验超时"}};
+  }
+  auto stream = acquire_stream(deadline);
+  if (!stream) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++requests_;
+    if (bounded && Clock::now() >= deadline) {
+      ++timeouts_;
+      return json{{"code", 408}, {"msg", "等待AI服务连接超时"}};
+    }
+    ++failures_;
+    return json{{"code", 500}, {"msg", "AI服务gRPC连接不可用"}};
+  }
+  uint64_t id = 0;
+  std::future<json> future;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++requests_;
+    if (stream->broken) {
+      ++failures_;
+      return json{{"code", 500}, {"msg", "AI服务gRPC流中断"}};
+    }
+    id = ++next_id_;
+    future = stream->pending[id].get_future();
+    stream->outbox.push_back({id, std::move(req)});
+    ++inflight_;
+    peak_inflight_ = std::max(peak_inflight_, inflight_);
+  }
+  stream->outbox_cv.notify_one();
+  bool ready = true;
+  if (bounded) {
+    ready = future.wait_until(deadline) == std::future_status::ready;
+  } else {
+    future.wait();
+  }
+  if (!ready) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 仍在等待表中说明结果未到，放弃该请求（未写出的不再写出）；
+    // 否则结果恰好已交还
+    if (stream->pending.erase(id) > 0) {
+      --inflight_;
+      ++timeouts_;
+      return json{{"code", 408}, {"msg", "AI校验超时"}};
+    }
+  }
+  json result = future.get();
+  std::lock_guard<std::mutex> lock(mutex_);
+  --inflight_;
+  if (result.is_object() && result.value("code", json()) == 500) ++failures_;
+  return result;
+}
+
+json AiGrpcBackend::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return {{"backend", "grpc"},
+          {"target", opts_.target},
+          {"connected", stream_ && !stream_->broken},
+          {"streams_opened", streams_opened_},
+          {"stream_failures", stream_failures_},
+          {"max_inflight", opts_.max_inflight},
+          {"inflight", inflight_},
+          {"peak_inflight", peak_inflight_},
+          {"requests", requests_},
+          {"failures", failures_},
+          {"timeouts", timeouts_},
+          {"write_stalls", write_stalls_}};
+}
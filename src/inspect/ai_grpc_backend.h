@@ -0,0 +1,105 @@
+#pragma once
+#include <grpcpp/grpcpp.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "ai_backend.h"
+#include "inference.grpc.pb.h"
+
+// gRPC后端：与推理服务保持一条 InferenceService.Verify 双向流，截图原始
+// 字节放在 protobuf bytes 字段中发送，每个请求带流内唯一的 request_id，
+// 后台线程读取结果并按 request_id 交还给等待的调用方，多个校验在同一
+// 连接上并发进行，不必逐张建立HTTP请求、也不做base64。
+// 请求放入流的发送队列，由该流的写线程依次写出，调用方只按自己的截止
+// 时间等待结果，不会被停滞的写入阻塞；单次写入超过 write_timeout_ms
+// （对端不再读取、流控窗口耗尽）时由看门狗取消整条流。
+// 流中断时在途请求全部以500失败，间隔 reconnect_backoff_ms 后由下一次
+// 请求重新建流。
+class AiGrpcBackend : public AiBackend {
+ public:
+  struct Options {
+    std::string target = "127.0.0.1:50061";  // 推理服务地址 host:port
+    bool tls = false;
+    int connect_timeout_ms = 3000;
+    int reconnect_backoff_ms = 1000;
+    int keepalive_ms = 10000;  // HTTP/2 keepalive ping 间隔，0为关闭
+    int write_timeout_ms = 5000;  // 单次写入的最长阻塞时间，超过即取消流
+    size_t max_inflight = 64;  // 流上的最大在途请求数，由AI并发上限保证
+  };
+
+  explicit AiGrpcBackend(const Options &opts);
+  ~AiGrpcBackend() override;
+  AiGrpcBackend(const AiGrpcBackend &) = delete;
+  AiGrpcBackend &operator=(const AiGrpcBackend &) = delete;
+
+  nlohmann::json post(std::shared_ptr<const AiRequest> req,
+                      std::chrono::steady_clock::time_point deadline) override;
+
+  size_t max_concurrency() const override { return opts_.max_inflight; }
+
+  // 流状态、建流次数、在途请求数及峰值、请求/失败/超时/写入停滞次数
+  nlohmann::json stats() override;
+
+ private:
+  using ReaderWriter =
+      grpc::ClientReaderWriter<edgeservice::VerifyRequest,
+                               edgeservice::VerifyResponse>;
+
+  // 待写出的请求
+  struct Outgoing {
+    uint64_t id;
+    std::shared_ptr<const AiRequest> req;
+  };
+
+  // 一条双向流；broken 后不再写入，由下一次请求替换。
+  // 除 ctx、rw 与线程外的字段受 mutex_ 保护
+  struct Stream {
+    grpc::ClientContext ctx;
+    std::unique_ptr<ReaderWriter> rw;
+    std::unordered_map<uint64_t, std::promise<nlohmann::json>> pending;
+    std::deque<Outgoing> outbox;
+    std::condition_variable outbox_cv;
+    bool writing = false;  // 写线程正阻塞在 Write 中
+    std::chrono::steady_clock::time_point write_started;
+    bool cancelled = false;  // 已被看门狗取消
+    bool broken = false;
+    std::thread reader;
+    std::thread writer;
+  };
+
+  std::shared_ptr<Stream> acquire_stream(
+      std::chrono::steady_clock::time_point deadline);
+  void read_loop(const std::shared_ptr<Stream> &stream);
+  void write_loop(const std::shared_ptr<Stream> &stream);
+  void watchdog_loop();
+
+  Options opts_;
+  std::shared_ptr<grpc::Channel> channel_;
+  std::unique_ptr<edgeservice::InferenceService::Stub> stub_;
+
+  std::mutex mutex_;  // 保护以下字段及 Stream 中的状态
+  std::shared_ptr<Stream> stream_;
+  std::chrono::steady_clock::time_point reconnect_at_;  // 建流失败后的冷却
+  bool exit_ = false;
+  uint64_t next_id_ = 0;
+  size_t inflight_ = 0;
+  size_t peak_inflight_ = 0;
+  uint64_t streams_opened_ = 0;
+  uint64_t stream_failures_ = 0;
+  uint64_t requests_ = 0;
+  uint64_t failures_ = 0;
+  uint64_t timeouts_ = 0;
+  uint64_t write_stalls_ = 0;  // 写入停滞被看门狗取消的次数
+  std::condition_variable watchdog_cv_;
+  std::thread watchdog_;
+};
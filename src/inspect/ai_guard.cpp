@@ -0,0 +1,232 @@
+#include "ai_guard.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+// 延迟 EWMA 系数：基线跟随缓慢，近期延迟反应快
+static constexpr double kBaselineAlpha = 0.02;
+static constexpr double kRecentAlpha = 0.2;
+
+AiGuard::AiGuard(const Options &opts) : opts_(opts) {
+  if (opts_.max_limit == 0) opts_.max_limit = 1;
+  opts_.min_limit = std::min(std::max<size_t>(opts_.min_limit, 1),
+                             opts_.max_limit);
+  limit_ = static_cast<double>(opts_.max_limit);
+  open_ms_ = opts_.breaker_open_ms;
+  if (opts_.breaker_window > 0) window_.assign(opts_.breaker_window, false);
+}
+
+int64_t AiGuard::retry_after_locked(Clock::time_point now) const {
+  if (state_ == State::kHalfOpen) return open_ms_;
+  return std::max<int64_t>(
+      1, std::chrono::duration_cast<std::chrono::milliseconds>(open_until_ -
+                                                               now)
+             .count());
+}
+
+bool AiGuard::is_open(int64_t &retry_after_ms) {
+  retry_after_ms = 0;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto now = Clock::now();
+  // 熔断到点后放行请求去做探测；半开时探测在途，其余请求仍快速失败
+  if (state_ == State::kClosed ||
+      (state_ == State::kOpen && now >= open_until_) ||
+      (state_ == State::kHalfOpen && !probing_)) {
+    return false;
+  }
+  retry_after_ms = retry_after_locked(now);
+  ++rejected_;
+  return true;
+}
+
+AiGuard::Admit AiGuard::acquire(Clock::time_point deadline, Permit &permit,
+                                int64_t &retry_after_ms) {
+  retry_after_ms = 0;
+  permit = Permit();
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto now = Clock::now();
+  if (state_ == State::kOpen && now >= open_until_) {
+    state_ = State::kHalfOpen;
+  }
+  if (state_ == State::kOpen || (state_ == State::kHalfOpen && probing_)) {
+    retry_after_ms = retry_after_locked(now);
+    ++rejected_;
+    return Admit::kOpen;
+  }
+  if (state_ == State::kHalfOpen) {
+    // 探测请求不受并发上限约束，结束前其余请求快速失败
+    probing_ = true;
+    permit.probe = true;
+  } else if (inflight_ >= static_cast<size_t>(limit_)) {
+    ++waits_;
+    auto ready = [this] {
+      return state_ != State::kClosed ||
+             inflight_ < static_cast<size_t>(limit_);
+    };
+    if (deadline == Clock::time_point::max()) {
+      cv_.wait(lock, ready);
+    } else if (!cv_.wait_until(lock, deadline, ready)) {
+      ++wait_timeouts_;
+      return Admit::kTimeout;
+    }
+    if (state_ != State::kClosed) {
+      retry_after_ms = retry_after_locked(Clock::now());
+      ++rejected_;
+      return Admit::kOpen;
+    }
+  }
+  ++inflight_;
+  peak_inflight_ = std::max(peak_inflight_, inflight_);
+  permit.start = Clock::now();
+  return Admit::kOk;
+}
+
+// 过载：并发上限乘性减小，一个近期延迟内最多减一次，避免同一批慢请求
+// 把上限连续压到底
+void AiGuard::on_overload_locked(Clock::time_point now) {
+  if (!opts_.adaptive) return;
+  auto interval = std::chrono::milliseconds(static_cast<int64_t>(recent_ms_));
+  if (decreases_ > 0 && now - last_decrease_ < interval) return;
+  double limit = std::max(static_cast<double>(opts_.min_limit),
+                          std::floor(limit_ * opts_.backoff_ratio));
+  if (limit < limit_) {
+    limit_ = limit;
+    ++decreases_;
+    last_decrease_ = now;
+  }
+}
+
+void AiGuard::trip_locked(Clock::time_point now) {
+  state_ = State::kOpen;
+  open_until_ = now + std::chrono::milliseconds(open_ms_);
+  ++trips_;
+  spdlog::warn("AI服务异常，熔断{}毫秒（连续失败{}次，窗口失败{}次）",
+               open_ms_, consecutive_failures_, window_failures_);
+}
+
+void AiGuard::release(const Permit &permit, Outcome outcome) {
+  if (outcome == Outcome::kIgnored) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (inflight_ > 0) --inflight_;
+      ++ignored_;
+      // 探测没有得出结论，由下一个请求重新探测
+      if (permit.probe) probing_ = false;
+    }
+    cv_.notify_all();
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    double latency_ms =
+        std::chrono::duration<double, std::milli>(now - permit.start).count();
+    if (inflight_ > 0) --inflight_;
+    ++requests_;
+    bool failed = outcome == Outcome::kFailure;
+    // 自适应并发
+    if (outcome == Outcome::kSuccess) {
+      if (baseline_ms_ <= 0) {
+        baseline_ms_ = latency_ms;
+        recent_ms_ = latency_ms;
+      } else {
+        baseline_ms_ += kBaselineAlpha * (latency_ms - baseline_ms_);
+        recent_ms_ += kRecentAlpha * (latency_ms - recent_ms_);
+      }
+      if (recent_ms_ > baseline_ms_ * opts_.latency_tolerance) {
+        on_overload_locked(now);
+      } else if (opts_.adaptive && limit_ < opts_.max_limit &&
+                 inflight_ + 1 >= static_cast<size_t>(limit_) / 2) {
+        // 名额确实用得上时才增大，每个上限周期约加一
+        limit_ = std::min(static_cast<double>(opts_.max_limit),
+                          limit_ + 1.0 / limit_);
+        ++increases_;
+      }
+    } else {
+      on_overload_locked(now);
+    }
+    // 熔断
+    if (permit.probe) {
+      probing_ = false;
+      if (outcome != Outcome::kSuccess) {
+        open_ms_ = std::min(open_ms_ * 2, opts_.breaker_open_max_ms);
+        trip_locked(now);
+      } else {
+        state_ = State::kClosed;
+        open_ms_ = opts_.breaker_open_ms;
+        consecutive_failures_ = 0;
+        std::fill(window_.begin(), window_.end(), false);
+        window_failures_ = 0;
+        spdlog::info("AI服务探测成功，解除熔断");
+      }
+    } else if (state_ == State::kClosed && opts_.breaker_failures > 0) {
+      consecutive_failures_ = failed ? consecutive_failures_ + 1 : 0;
+      bool window_full = false;
+      if (!window_.empty()) {
+        if (window_[window_next_]) --window_failures_;
+        window_[window_next_] = failed;
+        if (failed) ++window_failures_;
+        window_next_ = (window_next_ + 1) % window_.size();
+        window_full = requests_ >= window_.size();
+      }
+      if (consecutive_failures_ >= opts_.breaker_failures ||
+          (window_full &&
+           window_failures_ >=
+               opts_.breaker_failure_ratio * window_.size())) {
+        trip_locked(now);
+      }
+    }
+  }
+  cv_.notify_all();
+}
+
+AiGuard::Outcome AiGuard::outcome_of(const json &result,
+                                     std::chrono::milliseconds budget,
+                                     std::chrono::milliseconds ai_timeout) {
+  if (result.is_object() && result.contains("code") &&
+      result["code"].is_number_integer()) {
+    int code = result["code"].get<int>();
+    if (code == 500) return Outcome::kFailure;
+    if (code == 408) {
+      return budget >= ai_timeout ? Outcome::kTimeout : Outcome::kIgnored;
+    }
+  }
+  return Outcome::kSuccess;
+}
+
+json AiGuard::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto now = Clock::now();
+  const char *state = state_ == State::kClosed ? "closed"
+                      : state_ == State::kOpen ? "open"
+                                               : "half_open";
+  int64_t retry_after_ms = state_ == State::kClosed ? 0
+                           : state_ == State::kOpen && now >= open_until_
+                               ? 0
+                               : retry_after_locked(now);
+  return json{{"adaptive", opts_.adaptive},
+              {"limit", static_cast<size_t>(limit_)},
+              {"min_limit", opts_.min_limit},
+              {"max_limit", opts_.max_limit},
+              {"inflight", inflight_},
+              {"peak_inflight", peak_inflight_},
+              {"baseline_latency_ms", baseline_ms_},
+              {"recent_latency_ms", recent_ms_},
+              {"increases", increases_},
+              {"decreases", decreases_},
+              {"waits", waits_},
+              {"wait_timeouts", wait_timeouts_},
+              {"ignored", ignored_},
+              {"breaker",
+               {{"state", state},
+                {"retry_after_ms", retry_after_ms},
+                {"consecutive_failures", consecutive_failures_},
+                {"window_failures", window_failures_},
+                {"trips", trips_},
+                {"rejected", rejected_}}}};
+}
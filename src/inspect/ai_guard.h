@@ -0,0 +1,98 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <vector>
+
+// AI服务调用保护：自适应并发限制 + 熔断。
+// 并发上限按 AIMD 调整：近期延迟（短期 EWMA）超过基线延迟（长期 EWMA）
+// 的 latency_tolerance 倍或请求超时时乘性减小，否则在名额用得上时加性
+// 增大，AI 服务变慢时不再继续堆请求。连续失败或窗口内失败率过高时熔断：
+// 熔断期内请求立即失败，截图前也可据此跳过；到点后放行一次探测，成功即
+// 恢复，失败则熔断时长翻倍。
+class AiGuard {
+ public:
+  struct Options {
+    bool adaptive = true;        // 关闭时并发上限固定为 max_limit
+    size_t min_limit = 1;        // 并发上限下限
+    size_t max_limit = 16;       // 并发上限上限，即连接池大小
+    double latency_tolerance = 2.0;  // 近期延迟超过基线该倍数视为过载
+    double backoff_ratio = 0.9;      // 过载时并发上限乘以该系数
+    int breaker_failures = 5;  // 连续失败达到该次数熔断，0表示关闭熔断
+    size_t breaker_window = 20;            // 失败率统计的最近请求数
+    double breaker_failure_ratio = 0.5;    // 窗口内失败率达到该值熔断
+    int breaker_open_ms = 5000;            // 首次熔断时长
+    int breaker_open_max_ms = 60000;       // 熔断时长上限
+  };
+
+  enum class Admit { kOk, kOpen, kTimeout };
+  enum class Outcome {
+    kSuccess,  // AI服务给出了结果（含业务失败）
+    kFailure,  // 连接失败、HTTP错误、非JSON等服务异常，计入熔断
+    kTimeout,  // 超时，只作为过载信号减小并发上限
+    kIgnored,  // 调用方剩余时间不足导致的超时，不说明AI服务状况，只归还名额
+  };
+
+  // 一次获准的请求：是否为熔断后的探测、开始时间（用于计算延迟）
+  struct Permit {
+    bool probe = false;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  explicit AiGuard(const Options &opts);
+
+  // 熔断中返回 true，retry_after_ms 为剩余熔断时长；不占用探测机会
+  bool is_open(int64_t &retry_after_ms);
+
+  // 申请一个并发名额，名额不足时等待，不超过 deadline。
+  // 熔断中返回 kOpen；返回 kOk 后须以同一 permit 调用 release
+  Admit acquire(std::chrono::steady_clock::time_point deadline,
+                Permit &permit, int64_t &retry_after_ms);
+  void release(const Permit &permit, Outcome outcome);
+
+  // AI服务返回的传输层结果：500为服务异常；408只有在请求拿到的时间
+  // budget 不少于AI请求超时 ai_timeout 时才算过载，否则是调用方截止时间
+  // 过短，记为 kIgnored；其余均视为服务正常
+  static Outcome outcome_of(const nlohmann::json &result,
+                            std::chrono::milliseconds budget,
+                            std::chrono::milliseconds ai_timeout);
+
+  // 当前并发上限、在途数、基线/近期延迟、调整次数与熔断状态
+  nlohmann::json stats();
+
+ private:
+  enum class State { kClosed, kOpen, kHalfOpen };
+
+  void on_overload_locked(std::chrono::steady_clock::time_point now);
+  void trip_locked(std::chrono::steady_clock::time_point now);
+  int64_t retry_after_locked(std::chrono::steady_clock::time_point now) const;
+
+  Options opts_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  double limit_;
+  size_t inflight_ = 0;
+  size_t peak_inflight_ = 0;
+  double baseline_ms_ = 0;  // 长期 EWMA
+  double recent_ms_ = 0;    // 短期 EWMA
+  std::chrono::steady_clock::time_point last_decrease_;
+  uint64_t requests_ = 0;
+  uint64_t increases_ = 0;
+  uint64_t decreases_ = 0;
+  uint64_t waits_ = 0;          // 名额不足需等待的次数
+  uint64_t wait_timeouts_ = 0;  // 等到截止时间仍无名额的次数
+  uint64_t ignored_ = 0;        // 因调用方截止时间过短而超时、不计入的请求数
+
+  State state_ = State::kClosed;
+  bool probing_ = false;  // 半开状态下的探测请求在途
+  int consecutive_failures_ = 0;
+  std::vector<bool> window_;  // 最近请求是否失败，环形缓冲
+  size_t window_next_ = 0;
+  size_t window_failures_ = 0;
+  int open_ms_ = 0;  // 本次熔断时长
+  std::chrono::steady_clock::time_point open_until_;
+  uint64_t trips_ = 0;
+  uint64_t rejected_ = 0;  // 熔断期间被快速拒绝的请求数
+};
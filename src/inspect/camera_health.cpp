@@ -0,0 +1,161 @@
+#include "camera_health.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+static int64_t ms_since(Clock::time_point t, Clock::time_point now) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(now - t)
+      .count();
+}
+
+CameraHealth::CameraHealth(const Options &opts) : opts_(opts) {
+  if (opts_.latency_samples == 0) opts_.latency_samples = 1;
+}
+
+bool CameraHealth::admit(uint64_t camera_id, int64_t &retry_after_ms) {
+  retry_after_ms = 0;
+  if (opts_.fail_threshold <= 0) return true;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(camera_id);
+  if (it == entries_.end()) return true;
+  Entry &e = it->second;
+  if (e.consecutive_failures < opts_.fail_threshold) return true;
+  auto now = Clock::now();
+  if (now >= e.retry_at) {
+    // 退避到点：放行这一次探测，探测结束前其它请求仍快速失败
+    e.retry_at = now + std::chrono::milliseconds(opts_.backoff_base_ms);
+    return true;
+  }
+  retry_after_ms = std::max<int64_t>(1, -ms_since(e.retry_at, now));
+  ++e.fast_failed;
+  ++fast_failed_;
+  return false;
+}
+
+void CameraHealth::record_success(uint64_t camera_id, double latency_ms) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Entry &e = entries_[camera_id];
+  if (opts_.fail_threshold > 0 &&
+      e.consecutive_failures >= opts_.fail_threshold) {
+    spdlog::info("摄像头{}恢复在线，此前连续失败{}次", camera_id,
+                 e.consecutive_failures);
+  }
+  e.consecutive_failures = 0;
+  e.retry_at = Clock::time_point();
+  ++e.successes;
+  e.last_success = Clock::now();
+  if (e.latencies.size() < opts_.latency_samples) {
+    e.latencies.push_back(static_cast<float>(latency_ms));
+  } else {
+    e.latencies[e.latency_next] = static_cast<float>(latency_ms);
+    e.latency_next = (e.latency_next + 1) % e.latencies.size();
+  }
+}
+
+void CameraHealth::record_failure(uint64_t camera_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Entry &e = entries_[camera_id];
+  auto now = Clock::now();
+  ++e.consecutive_failures;
+  ++e.failures;
+  e.last_failure = now;
+  if (opts_.fail_threshold <= 0 ||
+      e.consecutive_failures < opts_.fail_threshold) {
+    return;
+  }
+  int shift = std::min(e.consecutive_failures - opts_.fail_threshold, 16);
+  int64_t backoff = std::min<int64_t>(
+      static_cast<int64_t>(opts_.backoff_base_ms) << shift,
+      opts_.backoff_max_ms);
+  e.retry_at = now + std::chrono::milliseconds(backoff);
+  spdlog::warn("摄像头{}连续截图失败{}次，{}ms内不再实时截图", camera_id,
+               e.consecutive_failures, backoff);
+}
+
+double CameraHealth::percentile_locked(const Entry &e, double p) const {
+  if (e.latencies.empty()) return 0;
+  std::vector<float> v = e.latencies;
+  size_t k = static_cast<size_t>(std::ceil(p * v.size()));
+  k = std::min(std::max<size_t>(k, 1), v.size()) - 1;
+  std::nth_element(v.begin(), v.begin() + k, v.end());
+  return v[k];
+}
+
+int CameraHealth::timeout_locked(const Entry &e) const {
+  if (e.latencies.size() < opts_.min_samples) return opts_.max_timeout_ms;
+  double t = percentile_locked(e, 0.99) * opts_.timeout_factor;
+  return static_cast<int>(std::clamp(
+      t, static_cast<double>(std::min(opts_.min_timeout_ms,
+                                      opts_.max_timeout_ms)),
+      static_cast<double>(opts_.max_timeout_ms)));
+}
+
+int CameraHealth::capture_timeout_ms(uint64_t camera_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(camera_id);
+  return it == entries_.end() ? opts_.max_timeout_ms
+                              : timeout_locked(it->second);
+}
+
+json CameraHealth::to_json_locked(uint64_t camera_id, const Entry &e) const {
+  auto now = Clock::now();
+  bool backing_off = opts_.fail_threshold > 0 &&
+                     e.consecutive_failures >= opts_.fail_threshold &&
+                     now < e.retry_at;
+  return json{
+      {"camera_id", camera_id},
+      {"healthy", e.consecutive_failures == 0},
+      {"consecutive_failures", e.consecutive_failures},
+      {"backing_off", backing_off},
+      {"retry_after_ms", backing_off ? -ms_since(e.retry_at, now) : 0},
+      {"successes", e.successes},
+      {"failures", e.failures},
+      {"fast_failed", e.fast_failed},
+      // 从未成功/失败过时为 -1
+      {"last_success_age_ms",
+       e.successes ? ms_since(e.last_success, now) : -1},
+      {"last_failure_age_ms", e.failures ? ms_since(e.last_failure, now) : -1},
+      {"latency_ms",
+       {{"samples", e.latencies.size()},
+        {"p50", percentile_locked(e, 0.5)},
+        {"p90", percentile_locked(e, 0.9)},
+        {"p99", percentile_locked(e, 0.99)}}},
+      {"capture_timeout_ms", timeout_locked(e)}};
+}
+
+json CameraHealth::get(uint64_t camera_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(camera_id);
+  if (it == entries_.end()) {
+    return json{{"code", 404},
+                {"msg", "该摄像头暂无截图记录"},
+                {"camera_id", camera_id}};
+  }
+  json resp = to_json_locked(camera_id, it->second);
+  resp["code"] = 0;
+  resp["msg"] = "";
+  return resp;
+}
+
+json CameraHealth::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto now = Clock::now();
+  size_t unhealthy = 0;
+  json backing_off = json::array();
+  for (const auto &[camera_id, e] : entries_) {
+    if (e.consecutive_failures > 0) ++unhealthy;
+    if (opts_.fail_threshold > 0 &&
+        e.consecutive_failures >= opts_.fail_threshold && now < e.retry_at) {
+      backing_off.push_back(camera_id);
+    }
+  }
+  return json{{"tracked", entries_.size()},
+              {"unhealthy", unhealthy},
+              {"backing_off", backing_off},
+              {"fast_failed", fast_failed_}};
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <unordered_map>
+#include <vector>
+
+// 摄像头健康登记：记录每个摄像头的连续截图失败次数、最近成功/失败时间
+// 与截图（建连+首帧）耗时分位数。连续失败达到阈值后按指数退避暂停实时
+// 截图，退避期内的请求立即失败，不再耗在必然失败的连接上；到点后放行
+// 一次探测，成功即恢复。成功样本足够时按历史 p99 推算该摄像头的截图超时。
+class CameraHealth {
+ public:
+  struct Options {
+    int fail_threshold = 3;        // 连续失败达到该次数开始退避，0表示关闭
+    int backoff_base_ms = 5000;    // 首次退避时长，之后每多失败一次翻倍
+    int backoff_max_ms = 300000;   // 退避时长上限
+    size_t latency_samples = 128;  // 保留的最近成功截图耗时样本数
+    size_t min_samples = 10;       // 样本数达到该值才按 p99 调整超时
+    double timeout_factor = 2.0;   // 自适应超时 = p99 * 该系数
+    int min_timeout_ms = 2000;     // 自适应超时下限
+    int max_timeout_ms = 10000;    // 自适应超时上限，即配置的截图超时
+  };
+
+  explicit CameraHealth(const Options &opts);
+
+  // 是否允许现在实时截图；退避期内返回 false，retry_after_ms 为剩余退避时长
+  bool admit(uint64_t camera_id, int64_t &retry_after_ms);
+
+  void record_success(uint64_t camera_id, double latency_ms);
+  void record_failure(uint64_t camera_id);
+
+  // 该摄像头的截图超时：样本不足时返回 max_timeout_ms，否则为 p99 乘以
+  // 系数，限制在 [min_timeout_ms, max_timeout_ms] 内
+  int capture_timeout_ms(uint64_t camera_id);
+
+  // 单个摄像头的健康状况；未登记时返回 {"code":404,...}
+  nlohmann::json get(uint64_t camera_id);
+
+  // 汇总：登记数、退避中的摄像头及快速失败次数
+  nlohmann::json stats();
+
+ private:
+  struct Entry {
+    int consecutive_failures = 0;
+    uint64_t successes = 0;
+    uint64_t failures = 0;
+    uint64_t fast_failed = 0;
+    std::chrono::steady_clock::time_point last_success;
+    std::chrono::steady_clock::time_point last_failure;
+    std::chrono::steady_clock::time_point retry_at;  // 退避结束时间
+    std::vector<float> latencies;                    // 环形缓冲
+    size_t latency_next = 0;
+  };
+
+  double percentile_locked(const Entry &e, double p) const;
+  int timeout_locked(const Entry &e) const;
+  nlohmann::json to_json_locked(uint64_t camera_id, const Entry &e) const;
+
+  Options opts_;
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, Entry> entries_;
+  uint64_t fast_failed_ = 0;
+};
@@ -0,0 +1,64 @@
+#include "delay_queue.h"
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+DelayQueue::DelayQueue() {
+  timer_ = std::thread([this]() { timer_loop(); });
+}
+
+DelayQueue::~DelayQueue() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exit_ = true;
+  }
+  cv_.notify_all();
+  if (timer_.joinable()) timer_.join();
+}
+
+void DelayQueue::post(Clock::time_point at, TaskFn fn) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!exit_) {
+      bool earliest = items_.empty() || at < items_.top().at;
+      items_.push(Item{at, next_seq_++, std::move(fn)});
+      if (earliest) cv_.notify_all();
+      return;
+    }
+  }
+  fn(false);
+}
+
+void DelayQueue::timer_loop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!exit_) {
+    if (items_.empty()) {
+      cv_.wait(lock);
+      continue;
+    }
+    if (Clock::now() < items_.top().at) {
+      cv_.wait_until(lock, items_.top().at);
+      continue;
+    }
+    // priority_queue::top 为 const，取出回调须先拷贝
+    TaskFn fn = items_.top().fn;
+    items_.pop();
+    ++fired_;
+    lock.unlock();
+    fn(true);
+    lock.lock();
+  }
+  // 退出时未到点的任务按取消回调
+  std::vector<TaskFn> cancelled;
+  while (!items_.empty()) {
+    cancelled.push_back(items_.top().fn);
+    items_.pop();
+  }
+  lock.unlock();
+  for (auto &fn : cancelled) fn(false);
+}
+
+json DelayQueue::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return json{{"pending", items_.size()}, {"fired", fired_}};
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// 延迟队列：任务按到点时间排序，由一个定时线程在到点时回调，等待期间
+// 不占用任何工作线程。回调在定时线程上执行，不得阻塞，应只把后续工作
+// 投递到其他线程。
+class DelayQueue {
+ public:
+  // fired 为 false 表示队列已关闭、任务未到点即被取消
+  using TaskFn = std::function<void(bool fired)>;
+
+  DelayQueue();
+  ~DelayQueue();  // 未到点的任务以 fn(false) 回调，保证回调都被调用
+  DelayQueue(const DelayQueue &) = delete;
+  DelayQueue &operator=(const DelayQueue &) = delete;
+
+  // 到 at 时回调 fn(true)；at 已过时尽快回调
+  void post(std::chrono::steady_clock::time_point at, TaskFn fn);
+
+  // 等待中的任务数与已回调次数
+  nlohmann::json stats();
+
+ private:
+  struct Item {
+    std::chrono::steady_clock::time_point at;
+    uint64_t seq = 0;  // 同一时间点按提交顺序回调
+    TaskFn fn;
+  };
+  struct Later {
+    bool operator()(const Item &a, const Item &b) const {
+      return a.at != b.at ? a.at > b.at : a.seq > b.seq;
+    }
+  };
+
+  void timer_loop();
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::priority_queue<Item, std::vector<Item>, Later> items_;
+  uint64_t next_seq_ = 0;
+  uint64_t fired_ = 0;
+  bool exit_ = false;
+  std::thread timer_;
+};
@@ -0,0 +1,153 @@
+#include "ffmpeg_pipe.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+
+extern char **environ;
+
+using Clock = std::chrono::steady_clock;
+
+// 启动子进程：stdout 接管道写端，stdin/stderr 接 /dev/null
+static bool spawn_with_stdout_pipe(const std::vector<std::string> &args,
+                                   pid_t &pid, int &read_fd,
+                                   std::string &err) {
+  int fds[2];
+  if (pipe2(fds, O_CLOEXEC) != 0) {
+    err = std::string("创建管道失败: ") + std::strerror(errno);
+    return false;
+  }
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null",
+                                   O_RDONLY, 0);
+  posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+  posix_spawn_file_actions_addopen(&actions, STDERR_FILENO, "/dev/null",
+                                   O_WRONLY, 0);
+  posix_spawnattr_t attr;
+  posix_spawnattr_init(&attr);
+#ifdef POSIX_SPAWN_USEVFORK
+  posix_spawnattr_setflags(&attr, POSIX_SPAWN_USEVFORK);
+#endif
+  std::vector<char *> argv;
+  argv.reserve(args.size() + 1);
+  for (const auto &a : args) argv.push_back(const_cast<char *>(a.c_str()));
+  argv.push_back(nullptr);
+  int ret = posix_spawn(&pid, argv[0], &actions, &attr, argv.data(), environ);
+  posix_spawnattr_destroy(&attr);
+  posix_spawn_file_actions_destroy(&actions);
+  close(fds[1]);
+  if (ret != 0) {
+    close(fds[0]);
+    err = std::string("启动ffmpeg失败: ") + std::strerror(ret);
+    return false;
+  }
+  read_fd = fds[0];
+  return true;
+}
+
+// 读管道直到子进程关闭标准输出；out 为空时丢弃数据。
+// 超过 deadline 返回 false 且 timed_out 为 true
+static bool read_until_eof(int fd, Clock::time_point deadline,
+                           std::vector<uint8_t> *out, bool &timed_out,
+                           std::string &err) {
+  // 先读入固定大小的块再追加到 out 尾部：out 按 vector 自身的倍增策略
+  // 扩容，只增长实际读到的字节数，不会把整块预留空间先清零
+  const size_t chunk_size = 64 * 1024;
+  std::unique_ptr<uint8_t[]> chunk(new uint8_t[chunk_size]);
+  if (out) {
+    out->clear();
+    if (out->capacity() == 0) out->reserve(256 * 1024);
+  }
+  bool ok = true;
+  while (true) {
+    int wait_ms = -1;
+    if (deadline != Clock::time_point::max()) {
+      auto remain = std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline - Clock::now());
+      if (remain.count() <= 0) {
+        timed_out = true;
+        err = "截图超时";
+        ok = false;
+        break;
+      }
+      wait_ms = static_cast<int>(std::min<int64_t>(remain.count(), INT32_MAX));
+    }
+    pollfd pfd{fd, POLLIN, 0};
+    int pr = poll(&pfd, 1, wait_ms);
+    if (pr < 0) {
+      if (errno == EINTR) continue;
+      err = std::string("等待ffmpeg输出失败: ") + std::strerror(errno);
+      ok = false;
+      break;
+    }
+    if (pr == 0) continue;  // 超时，回到循环顶部判定
+    ssize_t n = read(fd, chunk.get(), chunk_size);
+    if (n > 0) {
+      if (out) out->insert(out->end(), chunk.get(), chunk.get() + n);
+    } else if (n == 0) {
+      break;
+    } else if (errno != EINTR && errno != EAGAIN) {
+      err = std::string("读取ffmpeg输出失败: ") + std::strerror(errno);
+      ok = false;
+      break;
+    }
+  }
+  return ok;
+}
+
+bool run_ffmpeg(const std::vector<std::string> &args,
+                Clock::time_point deadline, std::vector<uint8_t> *out,
+                bool &timed_out, std::string &err) {
+  timed_out = false;
+  pid_t pid = 0;
+  int fd = -1;
+  if (!spawn_with_stdout_pipe(args, pid, fd, err)) return false;
+  bool read_ok = read_until_eof(fd, deadline, out, timed_out, err);
+  close(fd);
+  // 超时或读失败时子进程可能仍卡在网络IO上，直接杀掉
+  if (!read_ok) kill(pid, SIGKILL);
+  int status = 0;
+  while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+  }
+  if (!read_ok) return false;
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    err = "ffmpeg退出异常，状态码" + std::to_string(status);
+    return false;
+  }
+  return true;
+}
+
+bool capture_jpeg_ffmpeg_pipe(const std::string &ffmpeg_path,
+                              const std::string &url, int jpeg_quality,
+                              const std::string &video_filter,
+                              size_t reserve_bytes, Clock::time_point deadline,
+                              std::vector<uint8_t> &jpeg, bool &timed_out,
+                              std::string &err) {
+  std::vector<std::string> args = {ffmpeg_path, "-nostdin", "-loglevel",
+                                   "quiet"};
+  // rtsp强制走tcp，http-flv不加该参数
+  if (url.rfind("rtsp://", 0) == 0) {
+    args.insert(args.end(), {"-rtsp_transport", "tcp"});
+  }
+  args.insert(args.end(), {"-i", url, "-frames:v", "1"});
+  if (!video_filter.empty()) args.insert(args.end(), {"-vf", video_filter});
+  args.insert(args.end(), {"-q:v", std::to_string(jpeg_quality), "-c:v",
+                           "mjpeg", "-f", "image2pipe", "pipe:1"});
+  jpeg.clear();
+  jpeg.reserve(reserve_bytes);
+  if (!run_ffmpeg(args, deadline, &jpeg, timed_out, err)) return false;
+  if (jpeg.empty()) {
+    err = "ffmpeg未输出图片";
+    return false;
+  }
+  return true;
+}
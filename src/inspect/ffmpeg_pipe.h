@@ -0,0 +1,23 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 以 posix_spawn（vfork语义，不复制父进程页表、不经过 /bin/sh）运行
+// ffmpeg 并等待其退出；out 非空时把子进程标准输出读入 out。超过 deadline
+// 仍未结束则杀掉子进程，timed_out 置为 true。
+bool run_ffmpeg(const std::vector<std::string> &args,
+                std::chrono::steady_clock::time_point deadline,
+                std::vector<uint8_t> *out, bool &timed_out, std::string &err);
+
+// 零落盘截图：图片以 -f image2pipe 写到 ffmpeg 标准输出，经管道读入
+// 预分配的内存缓冲，不再写 snapshot 文件，同一摄像头并发截图互不冲突。
+// video_filter 非空时作为 -vf 参数（裁剪缩放）。
+bool capture_jpeg_ffmpeg_pipe(const std::string &ffmpeg_path,
+                              const std::string &url, int jpeg_quality,
+                              const std::string &video_filter,
+                              size_t reserve_bytes,
+                              std::chrono::steady_clock::time_point deadline,
+                              std::vector<uint8_t> &jpeg, bool &timed_out,
+                              std::string &err);
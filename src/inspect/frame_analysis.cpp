@@ -0,0 +1,239 @@
+#include "frame_analysis.h"
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+}
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include "frame_grabber.h"
+
+static bool decode_luma_with(AVCodecContext *dec, AVPacket *pkt,
+                             AVFrame *frame, const std::vector<uint8_t> &jpeg,
+                             LumaImage &luma, std::string &err) {
+  int ret = avcodec_open2(dec, dec->codec, nullptr);
+  if (ret < 0) {
+    err = "打开JPEG解码器失败: " + av_error_string(ret);
+    return false;
+  }
+  // 解码器要求输入带 AV_INPUT_BUFFER_PADDING_SIZE 的填充，这里拷贝一次
+  if (av_new_packet(pkt, static_cast<int>(jpeg.size())) < 0) {
+    err = "分配数据包失败";
+    return false;
+  }
+  std::memcpy(pkt->data, jpeg.data(), jpeg.size());
+  ret = avcodec_send_packet(dec, pkt);
+  if (ret >= 0) ret = avcodec_receive_frame(dec, frame);
+  if (ret < 0) {
+    err = "JPEG解码失败: " + av_error_string(ret);
+    return false;
+  }
+  // MJPEG 输出 YUVJ4xxP 或 GRAY8，第一个平面即亮度
+  luma.width = frame->width;
+  luma.height = frame->height;
+  luma.stride = frame->width;
+  luma.data.resize(static_cast<size_t>(frame->width) * frame->height);
+  for (int y = 0; y < frame->height; ++y) {
+    std::memcpy(&luma.data[static_cast<size_t>(y) * luma.stride],
+                frame->data[0] + static_cast<ptrdiff_t>(y) * frame->linesize[0],
+                frame->width);
+  }
+  return true;
+}
+
+bool decode_jpeg_luma(const std::vector<uint8_t> &jpeg, int lowres,
+                      LumaImage &luma, std::string &err) {
+  const AVCodec *codec = avcodec_find_decoder(AV_CODEC_ID_MJPEG);
+  if (!codec) {
+    err = "未找到MJPEG解码器";
+    return false;
+  }
+  AVCodecContext *dec = avcodec_alloc_context3(codec);
+  AVPacket *pkt = av_packet_alloc();
+  AVFrame *frame = av_frame_alloc();
+  if (dec) {
+    dec->lowres = std::clamp(lowres, 0, 3);
+    dec->thread_count = 1;
+  }
+  bool ok = dec && pkt && frame &&
+            decode_luma_with(dec, pkt, frame, jpeg, luma, err);
+  av_frame_free(&frame);
+  av_packet_free(&pkt);
+  avcodec_free_context(&dec);
+  return ok;
+}
+
+// 一行中连续 n 个像素之和
+static uint32_t row_sum(const uint8_t *p, int n) {
+  uint32_t sum = 0;
+  int i = 0;
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  __m128i acc = zero;
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+    acc = _mm_add_epi64(acc, _mm_sad_epu8(v, zero));
+  }
+  sum = static_cast<uint32_t>(_mm_cvtsi128_si32(acc)) +
+        static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(acc, 8)));
+#elif defined(__aarch64__)
+  uint32x4_t acc = vdupq_n_u32(0);
+  for (; i + 16 <= n; i += 16) {
+    acc = vpadalq_u16(acc, vpaddlq_u8(vld1q_u8(p + i)));
+  }
+  sum = vaddvq_u32(acc);
+#endif
+  for (; i < n; ++i) sum += p[i];
+  return sum;
+}
+
+bool dhash64(const LumaImage &luma, uint64_t &hash) {
+  constexpr int kCols = 9;
+  constexpr int kRows = 8;
+  if (luma.width < kCols || luma.height < kRows) return false;
+  uint32_t cell[kRows][kCols];
+  for (int r = 0; r < kRows; ++r) {
+    int y0 = r * luma.height / kRows;
+    int y1 = (r + 1) * luma.height / kRows;
+    for (int c = 0; c < kCols; ++c) {
+      int x0 = c * luma.width / kCols;
+      int x1 = (c + 1) * luma.width / kCols;
+      uint64_t sum = 0;
+      for (int y = y0; y < y1; ++y) sum += row_sum(luma.row(y) + x0, x1 - x0);
+      cell[r][c] = static_cast<uint32_t>(sum / ((y1 - y0) * (x1 - x0)));
+    }
+  }
+  hash = 0;
+  for (int r = 0; r < kRows; ++r) {
+    for (int c = 0; c < kCols - 1; ++c) {
+      hash = (hash << 1) | (cell[r][c] < cell[r][c + 1] ? 1 : 0);
+    }
+  }
+  return true;
+}
+
+// 一行中连续 n 个像素的和与平方和
+static void row_sum_sq(const uint8_t *p, int n, uint64_t &sum, uint64_t &sq) {
+  uint32_t s = 0;
+  uint64_t q = 0;
+  int i = 0;
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  __m128i acc = zero;
+  __m128i acc_sq = zero;
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+    acc = _mm_add_epi64(acc, _mm_sad_epu8(v, zero));
+    __m128i lo = _mm_unpacklo_epi8(v, zero);
+    __m128i hi = _mm_unpackhi_epi8(v, zero);
+    // 每个32位通道每次最多累加 2*255^2，整行（<=8K像素）不会溢出
+    acc_sq = _mm_add_epi32(acc_sq, _mm_madd_epi16(lo, lo));
+    acc_sq = _mm_add_epi32(acc_sq, _mm_madd_epi16(hi, hi));
+  }
+  s = static_cast<uint32_t>(_mm_cvtsi128_si32(acc)) +
+      static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(acc, 8)));
+  alignas(16) uint32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), acc_sq);
+  q = static_cast<uint64_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__aarch64__)
+  uint32x4_t acc = vdupq_n_u32(0);
+  uint32x4_t acc_sq = vdupq_n_u32(0);
+  for (; i + 16 <= n; i += 16) {
+    uint8x16_t v = vld1q_u8(p + i);
+    acc = vpadalq_u16(acc, vpaddlq_u8(v));
+    uint16x8_t lo = vmull_u8(vget_low_u8(v), vget_low_u8(v));
+    uint16x8_t hi = vmull_u8(vget_high_u8(v), vget_high_u8(v));
+    acc_sq = vpadalq_u16(acc_sq, lo);
+    acc_sq = vpadalq_u16(acc_sq, hi);
+  }
+  s = vaddvq_u32(acc);
+  q = vaddlvq_u32(acc_sq);
+#endif
+  for (; i < n; ++i) {
+    s += p[i];
+    q += static_cast<uint32_t>(p[i]) * p[i];
+  }
+  sum += s;
+  sq += q;
+}
+
+// 行 c（不含首尾列）的4邻域拉普拉斯响应 4c-l-r-u-d 的和与平方和，
+// up/down 为上下相邻行
+static void laplacian_row(const uint8_t *up, const uint8_t *c,
+                          const uint8_t *down, int width, int64_t &sum,
+                          uint64_t &sq) {
+  int n = width - 1;
+  int64_t s = 0;
+  uint64_t q = 0;
+  int x = 1;
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i ones = _mm_set1_epi16(1);
+  __m128i acc = zero;
+  __m128i acc_sq = zero;
+  auto load8 = [&zero](const uint8_t *p) {
+    return _mm_unpacklo_epi8(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p)), zero);
+  };
+  for (; x + 8 <= n; x += 8) {
+    __m128i center = _mm_slli_epi16(load8(c + x), 2);
+    __m128i around = _mm_add_epi16(
+        _mm_add_epi16(load8(c + x - 1), load8(c + x + 1)),
+        _mm_add_epi16(load8(up + x), load8(down + x)));
+    __m128i lap = _mm_sub_epi16(center, around);  // 范围 -1020~1020
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(lap, ones));
+    // 每次最多累加 2*1020^2，整行（<=8K像素）不会溢出 uint32
+    acc_sq = _mm_add_epi32(acc_sq, _mm_madd_epi16(lap, lap));
+  }
+  alignas(16) int32_t lanes[4];
+  alignas(16) uint32_t lanes_sq[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), acc);
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes_sq), acc_sq);
+  s = static_cast<int64_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+  q = static_cast<uint64_t>(lanes_sq[0]) + lanes_sq[1] + lanes_sq[2] +
+      lanes_sq[3];
+#endif
+  for (; x < n; ++x) {
+    int lap = 4 * c[x] - c[x - 1] - c[x + 1] - up[x] - down[x];
+    s += lap;
+    q += static_cast<uint64_t>(lap * lap);
+  }
+  sum += s;
+  sq += q;
+}
+
+FrameQuality measure_quality(const LumaImage &luma) {
+  return measure_quality(luma.data.data(), luma.width, luma.height,
+                         luma.stride);
+}
+
+FrameQuality measure_quality(const uint8_t *data, int width, int height,
+                             int stride) {
+  FrameQuality q;
+  if (width <= 0 || height <= 0) return q;
+  auto row = [data, stride](int y) { return data + y * stride; };
+  uint64_t sum = 0;
+  uint64_t sq = 0;
+  for (int y = 0; y < height; ++y) row_sum_sq(row(y), width, sum, sq);
+  double n = static_cast<double>(width) * height;
+  q.brightness = sum / n;
+  q.contrast = std::sqrt(std::max(0.0, sq / n - q.brightness * q.brightness));
+  if (width < 3 || height < 3) return q;
+  int64_t lap_sum = 0;
+  uint64_t lap_sq = 0;
+  for (int y = 1; y < height - 1; ++y) {
+    laplacian_row(row(y - 1), row(y), row(y + 1), width, lap_sum, lap_sq);
+  }
+  double m = static_cast<double>(width - 2) * (height - 2);
+  double mean = lap_sum / m;
+  q.sharpness = std::max(0.0, lap_sq / m - mean * mean);
+  return q;
+}
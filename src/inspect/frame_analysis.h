@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 灰度（亮度）图像，data 按行存储，每行 stride 字节
+struct LumaImage {
+  int width = 0;
+  int height = 0;
+  int stride = 0;
+  std::vector<uint8_t> data;
+
+  const uint8_t *row(int y) const { return data.data() + y * stride; }
+};
+
+// 解码 JPEG 只取亮度平面。lowres 为 0~3，按 1/2^lowres 缩小解码，
+// 只做画面分析时可大幅减少解码开销
+bool decode_jpeg_luma(const std::vector<uint8_t> &jpeg, int lowres,
+                      LumaImage &luma, std::string &err);
+
+// 差值哈希（dHash）：亮度图按区域均值缩小到 9x8，每行相邻像素比较
+// 得到 64 位指纹；画面不变时指纹的汉明距离接近 0
+bool dhash64(const LumaImage &luma, uint64_t &hash);
+
+// 画面质量指标
+struct FrameQuality {
+  double brightness = 0;  // 亮度均值（0~255）
+  double contrast = 0;    // 亮度标准差，纯色/灰屏接近 0
+  double sharpness = 0;   // 拉普拉斯响应的方差，模糊/花屏时明显偏低
+};
+
+// 计算亮度统计与拉普拉斯方差清晰度
+FrameQuality measure_quality(const LumaImage &luma);
+
+// 同上，直接作用于外部亮度平面（如解码帧的 Y 平面），不拷贝
+FrameQuality measure_quality(const uint8_t *data, int width, int height,
+                             int stride);
+
+inline int hamming_distance(uint64_t a, uint64_t b) {
+  return __builtin_popcountll(a ^ b);
+}
@@ -0,0 +1,57 @@
+#include "frame_cache.h"
+
+using Clock = std::chrono::steady_clock;
+
+FrameCache::FrameCache(size_t max_bytes) : max_bytes_(max_bytes) {}
+
+void FrameCache::erase_locked(
+    std::unordered_map<uint64_t, Entry>::iterator it) {
+  bytes_ -= it->second.jpeg.size();
+  lru_.erase(it->second.lru);
+  entries_.erase(it);
+}
+
+bool FrameCache::get(uint64_t camera_id, const std::string &url,
+                     int max_age_ms, std::vector<uint8_t> &jpeg) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(camera_id);
+  if (it == entries_.end() || it->second.url != url ||
+      Clock::now() - it->second.captured_at >
+          std::chrono::milliseconds(max_age_ms)) {
+    ++misses_;
+    return false;
+  }
+  lru_.splice(lru_.begin(), lru_, it->second.lru);
+  jpeg = it->second.jpeg;
+  ++hits_;
+  return true;
+}
+
+void FrameCache::put(uint64_t camera_id, const std::string &url,
+                     const std::vector<uint8_t> &jpeg) {
+  if (jpeg.size() > max_bytes_) return;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(camera_id);
+  if (it != entries_.end()) erase_locked(it);
+  while (!lru_.empty() && bytes_ + jpeg.size() > max_bytes_) {
+    erase_locked(entries_.find(lru_.back()));
+    ++evictions_;
+  }
+  lru_.push_front(camera_id);
+  Entry &e = entries_[camera_id];
+  e.url = url;
+  e.jpeg = jpeg;
+  e.captured_at = Clock::now();
+  e.lru = lru_.begin();
+  bytes_ += jpeg.size();
+}
+
+nlohmann::json FrameCache::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return nlohmann::json{{"entries", entries_.size()},
+                        {"bytes", bytes_},
+                        {"max_bytes", max_bytes_},
+                        {"hits", hits_},
+                        {"misses", misses_},
+                        {"evictions", evictions_}};
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 截图缓存：每个摄像头保存最近一次实时截图的JPEG及截图时间，总字节数
+// 超出上限时按最近最少使用淘汰。调用方通过 max_age_ms 声明可接受的帧
+// 时长，缓存帧足够新时直接使用，不再重新拉流。
+class FrameCache {
+ public:
+  explicit FrameCache(size_t max_bytes);
+  FrameCache(const FrameCache &) = delete;
+  FrameCache &operator=(const FrameCache &) = delete;
+
+  // 取缓存帧：地址须一致且截图时间距今不超过 max_age_ms
+  bool get(uint64_t camera_id, const std::string &url, int max_age_ms,
+           std::vector<uint8_t> &jpeg);
+
+  // 保存该摄像头最新一次截图
+  void put(uint64_t camera_id, const std::string &url,
+           const std::vector<uint8_t> &jpeg);
+
+  // 缓存条目数、字节数及上限、命中/未命中/淘汰次数
+  nlohmann::json stats();
+
+ private:
+  struct Entry {
+    std::string url;
+    std::vector<uint8_t> jpeg;
+    std::chrono::steady_clock::time_point captured_at;
+    std::list<uint64_t>::iterator lru;
+  };
+
+  void erase_locked(std::unordered_map<uint64_t, Entry>::iterator it);
+
+  size_t max_bytes_;
+  std::mutex mutex_;
+  std::list<uint64_t> lru_;  // 头部为最近使用
+  std::unordered_map<uint64_t, Entry> entries_;
+  size_t bytes_ = 0;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+  uint64_t evictions_ = 0;
+};
@@ -0,0 +1,494 @@
+#include "frame_grabber.h"
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libswscale/swscale.h>
+}
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+std::string av_error_string(int errnum) {
+  char buf[AV_ERROR_MAX_STRING_SIZE] = "";
+  av_strerror(errnum, buf, sizeof(buf));
+  return std::string(buf);
+}
+
+// 网络协议只需初始化一次；libav日志同原 ffmpeg 命令行一样丢弃（2>/dev/null）
+static void init_libav_once() {
+  static std::once_flag flag;
+  std::call_once(flag, []() {
+    av_log_set_level(AV_LOG_QUIET);
+    avformat_network_init();
+  });
+}
+
+FrameGrabber::FrameGrabber() : FrameGrabber(Options{}) {}
+
+FrameGrabber::FrameGrabber(const Options &opts) : opts_(opts) {
+  init_libav_once();
+}
+
+FrameGrabber::~FrameGrabber() { close(); }
+
+int FrameGrabber::interrupt_cb(void *opaque) {
+  auto *self = static_cast<FrameGrabber *>(opaque);
+  if (self->abort_ && self->abort_->load()) return 1;
+  return std::chrono::steady_clock::now() > self->deadline_ ? 1 : 0;
+}
+
+void FrameGrabber::reset_deadline(int timeout_ms) {
+  deadline_ = std::min(
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms),
+      opts_.deadline);
+}
+
+int FrameGrabber::width() const { return dec_ctx_ ? dec_ctx_->width : 0; }
+
+int FrameGrabber::height() const { return dec_ctx_ ? dec_ctx_->height : 0; }
+
+bool FrameGrabber::open(const std::string &url, std::string &err) {
+  close();
+  reset_deadline(opts_.timeout_ms);
+  used_profile_ = false;
+  profile_mismatch_ = false;
+  bool mismatch = false;
+  if (opts_.profile) {
+    if (open_stream(url, opts_.profile.get(), mismatch, err)) {
+      used_profile_ = true;
+      return true;
+    }
+    // 连不上就直接失败；只有流参数对不上时才回退完整探测
+    if (!mismatch) return false;
+    profile_mismatch_ = true;
+    close();
+  }
+  return open_stream(url, nullptr, mismatch, err);
+}
+
+// 快速打开时的探测量：只用于补齐 HTTP-FLV 等打开后才出现的视频流
+static constexpr int64_t kFastProbeBytes = 32 * 1024;
+static constexpr int64_t kFastAnalyzeUs = 500 * 1000;
+
+bool FrameGrabber::open_stream(const std::string &url,
+                               const StreamProfile *profile, bool &mismatch,
+                               std::string &err) {
+  mismatch = false;
+  fmt_ctx_ = avformat_alloc_context();
+  if (!fmt_ctx_) {
+    err = "avformat_alloc_context失败";
+    return false;
+  }
+  fmt_ctx_->interrupt_callback.callback = &FrameGrabber::interrupt_cb;
+  fmt_ctx_->interrupt_callback.opaque = this;
+  if (profile) {
+    fmt_ctx_->probesize = kFastProbeBytes;
+    fmt_ctx_->max_analyze_duration = kFastAnalyzeUs;
+  }
+  AVDictionary *fmt_opts = nullptr;
+  // 与原ffmpeg命令行一致：rtsp强制走tcp，http-flv不加该参数；
+  // 有已学到的参数时沿用上次成功的传输方式
+  std::string transport;
+  if (profile) {
+    transport = profile->transport;
+  } else if (url.rfind("rtsp://", 0) == 0) {
+    transport = "tcp";
+  }
+  if (!transport.empty()) {
+    av_dict_set(&fmt_opts, "rtsp_transport", transport.c_str(), 0);
+  }
+  int ret = avformat_open_input(&fmt_ctx_, url.c_str(), nullptr, &fmt_opts);
+  av_dict_free(&fmt_opts);
+  if (ret < 0) {
+    // 失败时 avformat_open_input 已释放 fmt_ctx_ 并置空
+    err = "打开流失败: " + av_error_string(ret);
+    return false;
+  }
+  // RTSP 的视频流在 SDP 中已给出，沿用已学参数时无需再读包探测
+  bool need_probe =
+      !profile || av_find_best_stream(fmt_ctx_, AVMEDIA_TYPE_VIDEO, -1, -1,
+                                      nullptr, 0) < 0;
+  if (need_probe) {
+    ret = avformat_find_stream_info(fmt_ctx_, nullptr);
+    if (ret < 0) {
+      err = "获取流信息失败: " + av_error_string(ret);
+      close();
+      return false;
+    }
+  }
+  ret = av_find_best_stream(fmt_ctx_, AVMEDIA_TYPE_VIDEO, -1, -1, nullptr, 0);
+  if (ret < 0) {
+    err = "未找到视频流";
+    mismatch = profile != nullptr;
+    close();
+    return false;
+  }
+  video_stream_ = ret;
+  // 只解复用视频流，音频等其它流直接丢弃
+  for (unsigned i = 0; i < fmt_ctx_->nb_streams; ++i) {
+    if (static_cast<int>(i) != video_stream_) {
+      fmt_ctx_->streams[i]->discard = AVDISCARD_ALL;
+    }
+  }
+  const AVCodecParameters *par = fmt_ctx_->streams[video_stream_]->codecpar;
+  if (profile && par->codec_id != profile->codec_id) {
+    err = "视频编码与上次不一致";
+    mismatch = true;
+    close();
+    return false;
+  }
+  const AVCodec *codec = avcodec_find_decoder(par->codec_id);
+  if (!codec) {
+    err = "不支持的视频编码";
+    close();
+    return false;
+  }
+  dec_ctx_ = avcodec_alloc_context3(codec);
+  if (!dec_ctx_ || avcodec_parameters_to_context(dec_ctx_, par) < 0) {
+    err = "初始化解码器失败";
+    close();
+    return false;
+  }
+  // 未探测时 SDP/流头里可能缺少尺寸和 SPS/PPS，用上次学到的补齐
+  if (profile) {
+    if (dec_ctx_->width <= 0 || dec_ctx_->height <= 0) {
+      dec_ctx_->width = profile->width;
+      dec_ctx_->height = profile->height;
+    }
+    if (dec_ctx_->pix_fmt == AV_PIX_FMT_NONE) {
+      dec_ctx_->pix_fmt = static_cast<AVPixelFormat>(profile->pix_fmt);
+    }
+    if (dec_ctx_->extradata_size == 0 && !profile->extradata.empty()) {
+      size_t n = profile->extradata.size();
+      dec_ctx_->extradata = static_cast<uint8_t *>(
+          av_mallocz(n + AV_INPUT_BUFFER_PADDING_SIZE));
+      if (dec_ctx_->extradata) {
+        memcpy(dec_ctx_->extradata, profile->extradata.data(), n);
+        dec_ctx_->extradata_size = static_cast<int>(n);
+      }
+    }
+  }
+  // 只解一两帧，多线程解码反而增加首帧延迟
+  dec_ctx_->thread_count = 1;
+  if (opts_.low_delay) dec_ctx_->flags |= AV_CODEC_FLAG_LOW_DELAY;
+  ret = avcodec_open2(dec_ctx_, codec, nullptr);
+  if (ret < 0) {
+    err = "打开解码器失败: " + av_error_string(ret);
+    mismatch = profile != nullptr;
+    close();
+    return false;
+  }
+  pkt_ = av_packet_alloc();
+  got_keyframe_ = false;
+  stream_profile_ = StreamProfile();
+  stream_profile_.codec_id = dec_ctx_->codec_id;
+  stream_profile_.width = dec_ctx_->width;
+  stream_profile_.height = dec_ctx_->height;
+  stream_profile_.pix_fmt = dec_ctx_->pix_fmt;
+  if (dec_ctx_->extradata_size > 0) {
+    stream_profile_.extradata.assign(
+        dec_ctx_->extradata, dec_ctx_->extradata + dec_ctx_->extradata_size);
+  }
+  stream_profile_.transport = transport;
+  return true;
+}
+
+void FrameGrabber::close() {
+  if (pkt_) av_packet_free(&pkt_);
+  if (dec_ctx_) avcodec_free_context(&dec_ctx_);
+  if (fmt_ctx_) avformat_close_input(&fmt_ctx_);
+  video_stream_ = -1;
+  got_keyframe_ = false;
+}
+
+bool FrameGrabber::decode_frame(AVFrame *frame, bool keyframe_only,
+                                std::string &err) {
+  if (!fmt_ctx_) {
+    err = "流未打开";
+    return false;
+  }
+  while (true) {
+    int ret = avcodec_receive_frame(dec_ctx_, frame);
+    if (ret == 0) return true;
+    if (ret != AVERROR(EAGAIN)) {
+      err = "解码失败: " + av_error_string(ret);
+      return false;
+    }
+    ret = av_read_frame(fmt_ctx_, pkt_);
+    if (ret < 0) {
+      err = ret == AVERROR_EXIT ? "读取超时"
+                                : "读取失败: " + av_error_string(ret);
+      return false;
+    }
+    if (pkt_->stream_index != video_stream_) {
+      av_packet_unref(pkt_);
+      continue;
+    }
+    bool is_key = (pkt_->flags & AV_PKT_FLAG_KEY) != 0;
+    // 从GOP中间接入时关键帧之前的帧会花屏，直接丢弃
+    if ((!got_keyframe_ || keyframe_only) && !is_key) {
+      av_packet_unref(pkt_);
+      continue;
+    }
+    got_keyframe_ = true;
+    ret = avcodec_send_packet(dec_ctx_, pkt_);
+    av_packet_unref(pkt_);
+    if (ret < 0 && ret != AVERROR(EAGAIN)) {
+      err = "解码失败: " + av_error_string(ret);
+      return false;
+    }
+  }
+}
+
+// 亮度平面为单独存放的 8 位 Y 平面的像素格式，可直接评分
+static bool has_luma_plane(int format) {
+  switch (format) {
+    case AV_PIX_FMT_YUV420P:
+    case AV_PIX_FMT_YUVJ420P:
+    case AV_PIX_FMT_YUV422P:
+    case AV_PIX_FMT_YUVJ422P:
+    case AV_PIX_FMT_YUV444P:
+    case AV_PIX_FMT_YUVJ444P:
+    case AV_PIX_FMT_NV12:
+    case AV_PIX_FMT_NV21:
+    case AV_PIX_FMT_GRAY8:
+      return true;
+    default:
+      return false;
+  }
+}
+
+double FrameGrabber::score_frame(const AVFrame *frame) const {
+  if (!has_luma_plane(frame->format)) return 0;
+  return opts_.scorer(frame->data[0], frame->width, frame->height,
+                      frame->linesize[0]);
+}
+
+// 解码首帧到 best；开启连拍时继续解码后续帧，保留分数最高的一帧。
+// 连拍中途读取失败或超时不算失败，使用已得到的最好一帧
+bool FrameGrabber::decode_best_frame(AVFrame *frame, AVFrame *best,
+                                     std::string &err) {
+  burst_decoded_ = 0;
+  burst_picked_ = 0;
+  if (!decode_frame(best, false, err)) return false;
+  burst_decoded_ = 1;
+  bool burst = opts_.scorer && (opts_.burst_frames > 1 || opts_.burst_ms > 0);
+  if (!burst) return true;
+  int max_frames = opts_.burst_frames > 1 ? opts_.burst_frames : INT_MAX;
+  if (opts_.burst_ms > 0) {
+    deadline_ = std::min(deadline_, std::chrono::steady_clock::now() +
+                                        std::chrono::milliseconds(
+                                            opts_.burst_ms));
+  }
+  double best_score = score_frame(best);
+  std::string burst_err;
+  while (burst_decoded_ < max_frames &&
+         std::chrono::steady_clock::now() < deadline_ &&
+         decode_frame(frame, false, burst_err)) {
+    double score = score_frame(frame);
+    if (score > best_score) {
+      best_score = score;
+      burst_picked_ = burst_decoded_;
+      av_frame_unref(best);
+      av_frame_move_ref(best, frame);
+    }
+    ++burst_decoded_;
+  }
+  return true;
+}
+
+bool FrameGrabber::grab_jpeg(const std::string &url, std::vector<uint8_t> &jpeg,
+                             std::string &err) {
+  if (!open(url, err)) return false;
+  AVFrame *frame = av_frame_alloc();
+  AVFrame *best = av_frame_alloc();
+  bool ok = decode_best_frame(frame, best, err) &&
+            encode_jpeg(best, opts_.jpeg_quality, opts_.transform, jpeg, err);
+  av_frame_free(&best);
+  av_frame_free(&frame);
+  close();
+  return ok;
+}
+
+static int even_floor(int v) { return v & ~1; }
+
+TransformPlan plan_transform(const FrameTransform &t, int width, int height) {
+  TransformPlan p;
+  p.crop_w = p.out_w = width;
+  p.crop_h = p.out_h = height;
+  if (t.empty() || width < 2 || height < 2) return p;
+  if (t.has_roi()) {
+    p.crop_x = even_floor(
+        std::clamp(static_cast<int>(t.roi_x * width), 0, width - 2));
+    p.crop_y = even_floor(
+        std::clamp(static_cast<int>(t.roi_y * height), 0, height - 2));
+    p.crop_w = std::clamp(static_cast<int>(t.roi_w * width), 2,
+                          width - p.crop_x);
+    p.crop_h = std::clamp(static_cast<int>(t.roi_h * height), 2,
+                          height - p.crop_y);
+  }
+  double scale = 1.0;
+  if (t.max_width > 0 && p.crop_w > t.max_width) {
+    scale = std::min(scale, static_cast<double>(t.max_width) / p.crop_w);
+  }
+  if (t.max_height > 0 && p.crop_h > t.max_height) {
+    scale = std::min(scale, static_cast<double>(t.max_height) / p.crop_h);
+  }
+  p.out_w = std::max(2, even_floor(static_cast<int>(p.crop_w * scale)));
+  p.out_h = std::max(2, even_floor(static_cast<int>(p.crop_h * scale)));
+  return p;
+}
+
+std::string transform_filter(const FrameTransform &t) {
+  std::string vf;
+  char buf[160];
+  if (t.has_roi()) {
+    snprintf(buf, sizeof(buf), "crop=iw*%.4f:ih*%.4f:iw*%.4f:ih*%.4f",
+             t.roi_w, t.roi_h, t.roi_x, t.roi_y);
+    vf = buf;
+  }
+  bool bound_w = t.max_width > 0;
+  bool bound_h = t.max_height > 0;
+  if (bound_w || bound_h) {
+    // 只缩小不放大；单边受限时另一边按比例取偶数
+    std::string w = bound_w ? "'min(iw," + std::to_string(t.max_width) + ")'"
+                            : std::string("-2");
+    std::string h = bound_h ? "'min(ih," + std::to_string(t.max_height) + ")'"
+                            : std::string("-2");
+    std::string scale = "scale=w=" + w + ":h=" + h;
+    if (bound_w && bound_h) {
+      scale += ":force_original_aspect_ratio=decrease:force_divisible_by=2";
+    }
+    scale += ":flags=area";
+    if (!vf.empty()) vf += ",";
+    vf += scale;
+  }
+  return vf;
+}
+
+// 转换为 MJPEG 编码器要求的全范围 YUV420，同时缩放到 width x height
+static bool to_yuvj420p(const AVFrame *src, int width, int height,
+                        AVFrame *dst, std::string &err) {
+  if (src->format == AV_PIX_FMT_YUVJ420P && src->width == width &&
+      src->height == height) {
+    if (av_frame_ref(dst, src) < 0) {
+      err = "av_frame_ref失败";
+      return false;
+    }
+    return true;
+  }
+  dst->format = AV_PIX_FMT_YUVJ420P;
+  dst->width = width;
+  dst->height = height;
+  if (av_frame_get_buffer(dst, 0) < 0) {
+    err = "分配图像缓冲失败";
+    return false;
+  }
+  // 缩小时用区域平均，既快又不产生混叠
+  int flags = width < src->width || height < src->height ? SWS_AREA
+                                                          : SWS_BILINEAR;
+  SwsContext *sws = sws_getContext(
+      src->width, src->height, static_cast<AVPixelFormat>(src->format),
+      dst->width, dst->height, AV_PIX_FMT_YUVJ420P, flags, nullptr, nullptr,
+      nullptr);
+  if (!sws) {
+    err = "不支持的像素格式";
+    return false;
+  }
+  sws_scale(sws, src->data, src->linesize, 0, src->height, dst->data,
+            dst->linesize);
+  sws_freeContext(sws);
+  return true;
+}
+
+static bool encode_jpeg_with(AVCodecContext *enc, AVFrame *yuv, AVPacket *pkt,
+                             const AVFrame *frame, int width, int height,
+                             int quality, std::vector<uint8_t> &out,
+                             std::string &err) {
+  enc->width = width;
+  enc->height = height;
+  enc->pix_fmt = AV_PIX_FMT_YUVJ420P;
+  enc->time_base = AVRational{1, 25};
+  enc->flags |= AV_CODEC_FLAG_QSCALE;
+  enc->global_quality = FF_QP2LAMBDA * quality;
+  int ret = avcodec_open2(enc, enc->codec, nullptr);
+  if (ret < 0) {
+    err = "打开JPEG编码器失败: " + av_error_string(ret);
+    return false;
+  }
+  if (!to_yuvj420p(frame, width, height, yuv, err)) return false;
+  yuv->quality = enc->global_quality;
+  yuv->pict_type = AV_PICTURE_TYPE_NONE;
+  ret = avcodec_send_frame(enc, yuv);
+  if (ret >= 0) ret = avcodec_receive_packet(enc, pkt);
+  if (ret < 0) {
+    err = "JPEG编码失败: " + av_error_string(ret);
+    return false;
+  }
+  out.assign(pkt->data, pkt->data + pkt->size);
+  return true;
+}
+
+static std::atomic<uint64_t> g_encoded_frames{0};
+static std::atomic<uint64_t> g_source_pixels{0};
+static std::atomic<uint64_t> g_output_pixels{0};
+
+EncodeCounters encode_counters() {
+  EncodeCounters c;
+  c.frames = g_encoded_frames.load();
+  c.source_pixels = g_source_pixels.load();
+  c.output_pixels = g_output_pixels.load();
+  return c;
+}
+
+bool encode_jpeg(const AVFrame *frame, int quality, std::vector<uint8_t> &out,
+                 std::string &err) {
+  return encode_jpeg(frame, quality, FrameTransform{}, out, err);
+}
+
+bool encode_jpeg(const AVFrame *frame, int quality,
+                 const FrameTransform &transform, std::vector<uint8_t> &out,
+                 std::string &err) {
+  const AVCodec *codec = avcodec_find_encoder(AV_CODEC_ID_MJPEG);
+  if (!codec) {
+    err = "未找到MJPEG编码器";
+    return false;
+  }
+  TransformPlan plan = plan_transform(transform, frame->width, frame->height);
+  // 裁剪作用在帧引用上，只调整 data 指针与宽高，不拷贝像素
+  AVFrame *src = av_frame_alloc();
+  if (!src || av_frame_ref(src, frame) < 0) {
+    av_frame_free(&src);
+    err = "av_frame_ref失败";
+    return false;
+  }
+  src->crop_left = plan.crop_x;
+  src->crop_top = plan.crop_y;
+  src->crop_right = frame->width - plan.crop_x - plan.crop_w;
+  src->crop_bottom = frame->height - plan.crop_y - plan.crop_h;
+  if (av_frame_apply_cropping(src, AV_FRAME_CROP_UNALIGNED) < 0) {
+    av_frame_free(&src);
+    err = "裁剪画面失败";
+    return false;
+  }
+  AVCodecContext *enc = avcodec_alloc_context3(codec);
+  AVFrame *yuv = av_frame_alloc();
+  AVPacket *pkt = av_packet_alloc();
+  bool ok = enc && yuv && pkt &&
+            encode_jpeg_with(enc, yuv, pkt, src, plan.out_w, plan.out_h,
+                             quality, out, err);
+  av_packet_free(&pkt);
+  av_frame_free(&yuv);
+  av_frame_free(&src);
+  avcodec_free_context(&enc);
+  if (ok) {
+    ++g_encoded_frames;
+    g_source_pixels += static_cast<uint64_t>(frame->width) * frame->height;
+    g_output_pixels += static_cast<uint64_t>(plan.out_w) * plan.out_h;
+  }
+  return ok;
+}
@@ -0,0 +1,164 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct AVCodecContext;
+struct AVFormatContext;
+struct AVFrame;
+struct AVPacket;
+
+// 编码前的裁剪与缩放：先裁出感兴趣区域（ROI），再等比缩小到不超过
+// max_width x max_height，只缩小不放大。送AI的画面无需原始分辨率。
+struct FrameTransform {
+  // ROI 按画面宽高归一化到 0~1；roi_w 或 roi_h 为 0 表示整幅画面
+  double roi_x = 0;
+  double roi_y = 0;
+  double roi_w = 0;
+  double roi_h = 0;
+  int max_width = 0;  // 0 表示不限
+  int max_height = 0;
+
+  bool has_roi() const { return roi_w > 0 && roi_h > 0; }
+  bool empty() const {
+    return !has_roi() && max_width <= 0 && max_height <= 0;
+  }
+};
+
+// 由源画面尺寸计算裁剪区域与输出尺寸（均取偶数，满足 YUV420 要求）
+struct TransformPlan {
+  int crop_x = 0;
+  int crop_y = 0;
+  int crop_w = 0;
+  int crop_h = 0;
+  int out_w = 0;
+  int out_h = 0;
+};
+TransformPlan plan_transform(const FrameTransform &t, int width, int height);
+
+// 同样的裁剪缩放写成 ffmpeg -vf 滤镜参数；无需处理时返回空串
+std::string transform_filter(const FrameTransform &t);
+
+// 上次完整探测该流得到的参数。再次打开同一地址时据此初始化解码器，
+// 跳过 avformat_find_stream_info 的探测（probesize/analyzeduration）
+struct StreamProfile {
+  int codec_id = 0;  // AVCodecID
+  int width = 0;
+  int height = 0;
+  int pix_fmt = -1;
+  std::vector<uint8_t> extradata;  // H.264/H.265 的 SPS/PPS 等
+  std::string transport;           // 成功时使用的 rtsp_transport，非rtsp为空
+};
+
+// 进程内取帧器：基于 libavformat/libavcodec 直接打开 RTSP/HTTP-FLV 地址，
+// 解码视频帧并在内存中编码为 JPEG，替代每次截图都 fork 一个 ffmpeg 进程。
+// 单个实例非线程安全，同一时刻只能由一个线程使用。
+class FrameGrabber {
+ public:
+  // 连拍选帧的评分函数，参数为解码帧的 8 位亮度平面，分数越高越好
+  using FrameScorer = std::function<double(const uint8_t *luma, int width,
+                                           int height, int stride)>;
+
+  struct Options {
+    int timeout_ms = 10000;  // 打开+读取的总超时（毫秒）
+    int jpeg_quality = 2;    // 同 ffmpeg -q:v，取值 2~31，越小质量越高
+    bool low_delay = false;  // 解码器不做帧重排缓存，只解关键帧时使用
+    FrameTransform transform;  // grab_jpeg 编码前的裁剪缩放
+    // 连拍选帧：首帧之后继续解码，最多 burst_frames 帧、不超过 burst_ms
+    // 毫秒（0表示只按帧数），按 scorer 取分数最高的一帧编码。
+    // burst_frames 为1且 burst_ms 为0，或 scorer 为空时只取首帧
+    int burst_frames = 1;
+    int burst_ms = 0;
+    FrameScorer scorer;
+    // 已学到的流参数，非空时先按它快速打开，参数对不上再完整探测
+    std::shared_ptr<const StreamProfile> profile;
+    // 硬截止时间，timeout_ms 算出的超时不会晚于它（任务剩余预算）
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::time_point::max();
+  };
+
+  FrameGrabber();
+  explicit FrameGrabber(const Options &opts);
+  ~FrameGrabber();
+  FrameGrabber(const FrameGrabber &) = delete;
+  FrameGrabber &operator=(const FrameGrabber &) = delete;
+
+  // 打开流并初始化视频解码器，失败时 err 给出原因
+  bool open(const std::string &url, std::string &err);
+  void close();
+  bool is_open() const { return fmt_ctx_ != nullptr; }
+
+  // 读取并解码下一帧视频帧到 frame；keyframe_only 时只解码关键帧
+  bool decode_frame(AVFrame *frame, bool keyframe_only, std::string &err);
+
+  // 一次性截图：打开流、解码一帧（连拍时取最好的一帧）、编码 JPEG 后关闭
+  bool grab_jpeg(const std::string &url, std::vector<uint8_t> &jpeg,
+                 std::string &err);
+
+  // 本次打开是否沿用了 Options::profile（未完整探测）；
+  // 沿用失败后回退完整探测时 profile_mismatch 为 true
+  bool used_profile() const { return used_profile_; }
+  bool profile_mismatch() const { return profile_mismatch_; }
+  // 最近一次成功打开时的流参数，供下次打开同一地址时使用
+  const StreamProfile &stream_profile() const { return stream_profile_; }
+
+  // 上一次 grab_jpeg 连拍解码的帧数及选中帧的序号（从0开始）
+  int burst_decoded() const { return burst_decoded_; }
+  int burst_picked() const { return burst_picked_; }
+
+  int width() const;
+  int height() const;
+
+  // 重新设置读超时（从现在起 timeout_ms 毫秒，不晚于 Options::deadline），
+  // 长连接复用时使用
+  void reset_deadline(int timeout_ms);
+
+  // 外部中止标志，置位后阻塞中的打开/读取立即返回
+  void set_abort_flag(const std::atomic<bool> *flag) { abort_ = flag; }
+
+ private:
+  static int interrupt_cb(void *opaque);
+  bool open_stream(const std::string &url, const StreamProfile *profile,
+                   bool &mismatch, std::string &err);
+  bool decode_best_frame(AVFrame *frame, AVFrame *best, std::string &err);
+  double score_frame(const AVFrame *frame) const;
+
+  Options opts_;
+  AVFormatContext *fmt_ctx_ = nullptr;
+  AVCodecContext *dec_ctx_ = nullptr;
+  AVPacket *pkt_ = nullptr;
+  int video_stream_ = -1;
+  bool got_keyframe_ = false;
+  bool used_profile_ = false;
+  bool profile_mismatch_ = false;
+  StreamProfile stream_profile_;
+  int burst_decoded_ = 0;
+  int burst_picked_ = 0;
+  std::chrono::steady_clock::time_point deadline_;
+  const std::atomic<bool> *abort_ = nullptr;
+};
+
+// 将解码后的帧编码为 JPEG（MJPEG 编码器），quality 同 ffmpeg -q:v
+bool encode_jpeg(const AVFrame *frame, int quality, std::vector<uint8_t> &out,
+                 std::string &err);
+
+// 同上，编码前按 transform 裁剪缩放；裁剪只移动平面指针，缩放与像素格式
+// 转换在同一次 swscale 中完成
+bool encode_jpeg(const AVFrame *frame, int quality,
+                 const FrameTransform &transform, std::vector<uint8_t> &out,
+                 std::string &err);
+
+// 经 encode_jpeg 编码的帧累计：帧数、源像素数、输出像素数
+struct EncodeCounters {
+  uint64_t frames = 0;
+  uint64_t source_pixels = 0;
+  uint64_t output_pixels = 0;
+};
+EncodeCounters encode_counters();
+
+// libav 错误码转可读字符串
+std::string av_error_string(int errnum);
@@ -0,0 +1,42 @@
+#include "frame_source.h"
+
+std::vector<FrameSource> frame_sources(const CheckOptions &opts,
+                                       bool cache_enabled, bool pool_enabled) {
+  std::vector<FrameSource> sources;
+  if (!opts.force_live) {
+    if (cache_enabled && opts.max_age_ms > 0) {
+      sources.push_back(FrameSource::kCache);
+    }
+    if (pool_enabled) sources.push_back(FrameSource::kSession);
+  }
+  sources.push_back(FrameSource::kLive);
+  return sources;
+}
+
+CheckOptions live_recapture_options(const CheckOptions &opts) {
+  CheckOptions live = opts;
+  live.max_age_ms = 0;
+  live.force_live = true;
+  return live;
+}
+
+FrameSource fetch_frame(const CheckOptions &opts, const CacheFetchFn &from_cache,
+                        const SessionFetchFn &from_session,
+                        uint64_t &frame_seq) {
+  frame_seq = 0;
+  for (FrameSource candidate : frame_sources(opts, static_cast<bool>(from_cache),
+                                             static_cast<bool>(from_session))) {
+    switch (candidate) {
+      case FrameSource::kCache:
+        if (from_cache()) return FrameSource::kCache;
+        break;
+      case FrameSource::kSession:
+        if (from_session(frame_seq)) return FrameSource::kSession;
+        frame_seq = 0;
+        break;
+      case FrameSource::kLive:
+        return FrameSource::kLive;
+    }
+  }
+  return FrameSource::kLive;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "inspect_impl.h"
+
+// 一次截图的画面来源
+enum class FrameSource {
+  kCache,    // 截图缓存（FrameCache），须调用方允许 max_age_ms
+  kSession,  // 常驻拉流会话的最新关键帧
+  kLive,     // 实时截图
+};
+
+// 按优先顺序列出本次截图可用的来源，最后一项总是实时截图。
+// force_live 时只能实时截图；max_age_ms 为0时不取截图缓存
+std::vector<FrameSource> frame_sources(const CheckOptions &opts,
+                                       bool cache_enabled, bool pool_enabled);
+
+// 重新截图（质量不合格重截、执行器自动重试）的参数：保留截止时间，
+// 必须实时截图，避免再次取到刚被拒绝的缓存帧或会话帧
+CheckOptions live_recapture_options(const CheckOptions &opts);
+
+// 取缓存帧 / 会话帧；取到时返回 true，会话帧同时给出帧序号。
+// 为空表示该来源未开启
+using CacheFetchFn = std::function<bool()>;
+using SessionFetchFn = std::function<bool(uint64_t &frame_seq)>;
+
+// 按 frame_sources 的顺序依次尝试，返回取到画面的来源；都没取到时返回
+// kLive，需要实时截图。取到会话帧时 frame_seq 为其序号，否则置0
+FrameSource fetch_frame(const CheckOptions &opts, const CacheFetchFn &from_cache,
+                        const SessionFetchFn &from_session,
+                        uint64_t &frame_seq);
@@ -0,0 +1,329 @@
+#include "inspect_executor.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <map>
+
+#include "frame_source.h"
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+InspectExecutor::InspectExecutor(const Options &opts, CheckFn check,
+                                 DoneFn done)
+    : opts_(opts), check_(std::move(check)), done_(std::move(done)) {
+  if (opts_.max_inflight == 0) opts_.max_inflight = 1;
+  if (opts_.task_concurrency == 0) opts_.task_concurrency = 1;
+}
+
+InspectExecutor::~InspectExecutor() { stop(); }
+
+void InspectExecutor::start() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (dispatcher_.joinable()) return;
+  exit_ = false;
+  dispatcher_ = std::thread([this]() { dispatch_loop(); });
+  spdlog::info("巡检执行器启动，在途摄像头上限{}，单任务并发{}",
+               opts_.max_inflight, opts_.task_concurrency);
+}
+
+void InspectExecutor::stop() {
+  std::thread dispatcher;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exit_ = true;
+    dispatcher.swap(dispatcher_);
+  }
+  cv_.notify_all();
+  if (dispatcher.joinable()) dispatcher.join();
+  // 流水线中的摄像头结果回调会访问本对象，等它们全部返回
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] { return inflight_ == 0; });
+}
+
+int64_t InspectExecutor::projected_wait_ms_locked(size_t cameras_ahead) const {
+  return static_cast<int64_t>(cameras_ahead * avg_service_ms_ /
+                              opts_.max_inflight);
+}
+
+// 处理一个摄像头至少需要的剩余时间
+std::chrono::milliseconds InspectExecutor::min_budget_locked() const {
+  return std::chrono::milliseconds(
+      static_cast<int64_t>(avg_service_ms_ * opts_.drop_ratio));
+}
+
+InspectExecutor::QueueInfo InspectExecutor::submit(
+    const std::string &task_id, std::vector<Camera> cameras, int timeout_sec,
+    DoneFn done) {
+  QueueInfo info;
+  if (!done) done = done_;
+  if (cameras.empty()) {
+    done(task_id, {});
+    return info;
+  }
+  auto task = std::make_shared<Task>();
+  task->task_id = task_id;
+  task->done = std::move(done);
+  // 请求内重复的摄像头只截图校验一次，完成后按原顺序展开结果
+  std::map<std::pair<uint64_t, std::string>, size_t> seen;
+  task->slots.reserve(cameras.size());
+  for (auto &cam : cameras) {
+    auto r = seen.emplace(std::make_pair(cam.camera_id, cam.rtsp_url),
+                          task->cameras.size());
+    if (r.second) {
+      task->cameras.push_back(std::move(cam));
+    } else {
+      int &max_age = task->cameras[r.first->second].max_age_ms;
+      max_age = std::min(max_age, cam.max_age_ms);
+    }
+    task->slots.push_back(r.first->second);
+  }
+  size_t folded = task->slots.size() - task->cameras.size();
+  task->deadline = Clock::now() + std::chrono::seconds(timeout_sec);
+  task->results.resize(task->cameras.size());
+  task->attempts.assign(task->cameras.size(), 0);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (opts_.max_queued_cameras > 0 &&
+        queued_cameras_ + task->cameras.size() > opts_.max_queued_cameras) {
+      ++rejected_tasks_;
+      info.accepted = false;
+      info.queue_depth = queued_cameras_;
+      info.projected_wait_ms = projected_wait_ms_locked(queued_cameras_);
+      return info;
+    }
+    task->seq = next_seq_++;
+    folded_cameras_ += folded;
+    // EDF下只有截止时间不晚于本任务的摄像头会排在它前面
+    for (const auto &t : tasks_) {
+      if (t->deadline <= task->deadline) {
+        info.queue_depth += t->cameras.size() - t->next;
+      }
+    }
+    info.projected_wait_ms = projected_wait_ms_locked(info.queue_depth);
+    queued_cameras_ += task->cameras.size();
+    tasks_.push_back(std::move(task));
+  }
+  cv_.notify_all();
+  return info;
+}
+
+InspectExecutor::QueueInfo InspectExecutor::queue_info() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  QueueInfo info;
+  info.queue_depth = queued_cameras_;
+  info.projected_wait_ms = projected_wait_ms_locked(queued_cameras_);
+  return info;
+}
+
+// 按请求顺序展开结果并回调 done
+void InspectExecutor::deliver(const TaskPtr &task) {
+  if (task->slots.size() == task->cameras.size()) {
+    task->done(task->task_id, std::move(task->results));
+    return;
+  }
+  std::vector<json> results;
+  results.reserve(task->slots.size());
+  for (size_t slot : task->slots) results.push_back(task->results[slot]);
+  task->done(task->task_id, std::move(results));
+}
+
+// 任务剩余未派发的摄像头全部以408结束；若已无在途摄像头则任务完成
+void InspectExecutor::drop_locked(const TaskPtr &task, const char *msg,
+                                  std::vector<TaskPtr> &completed) {
+  size_t n = task->cameras.size() - task->next;
+  if (n == 0) return;
+  for (size_t i = task->next; i < task->cameras.size(); ++i) {
+    task->results[i] = {
+        {"code", 408}, {"msg", msg}, {"camera_id", task->cameras[i].camera_id}};
+  }
+  task->next = task->cameras.size();
+  task->finished += n;
+  queued_cameras_ -= n;
+  dropped_cameras_ += n;
+  if (task->finished == task->cameras.size()) completed.push_back(task);
+}
+
+// 选出截止时间最早、且未达并发上限的任务派发一个摄像头；
+// 顺带丢弃已超时或剩余时间明显不够处理一个摄像头的任务
+bool InspectExecutor::pick_locked(TaskPtr &task, size_t &index,
+                                  std::vector<TaskPtr> &completed) {
+  auto now = Clock::now();
+  auto min_budget = min_budget_locked();
+  TaskPtr best;
+  for (const auto &t : tasks_) {
+    if (now >= t->deadline) {
+      drop_locked(t, "轮检超时", completed);
+    } else if (t->deadline - now < min_budget) {
+      drop_locked(t, "预计无法在超时前完成", completed);
+    }
+    if (t->next >= t->cameras.size()) continue;
+    if (t->inflight >= opts_.task_concurrency) continue;
+    if (!best || t->deadline < best->deadline ||
+        (t->deadline == best->deadline &&
+         (t->inflight < best->inflight ||
+          (t->inflight == best->inflight && t->seq < best->seq)))) {
+      best = t;
+    }
+  }
+  tasks_.erase(std::remove_if(tasks_.begin(), tasks_.end(),
+                              [](const TaskPtr &t) {
+                                return t->next >= t->cameras.size() &&
+                                       t->inflight == 0;
+                              }),
+               tasks_.end());
+  if (pick_retry_locked(best, task, index, completed)) return true;
+  if (!best) return false;
+  task = best;
+  index = best->next++;
+  ++best->inflight;
+  --queued_cameras_;
+  return true;
+}
+
+// 取延迟队列中已到点的重试：剩余时间已不够再处理一次的，以上次结果结束；
+// 否则截止时间不晚于 best 时优先派发重试
+bool InspectExecutor::pick_retry_locked(const TaskPtr &best, TaskPtr &task,
+                                        size_t &index,
+                                        std::vector<TaskPtr> &completed) {
+  auto now = Clock::now();
+  while (!retries_.empty() && retries_.top().ready_at <= now) {
+    Retry r = retries_.top();
+    if (r.task->deadline - now < min_budget_locked()) {
+      retries_.pop();
+      ++retry_exhausted_;
+      if (++r.task->finished == r.task->cameras.size()) {
+        completed.push_back(r.task);
+      }
+      continue;
+    }
+    if (r.task->inflight >= opts_.task_concurrency) return false;
+    if (best && best->deadline < r.task->deadline) return false;
+    retries_.pop();
+    task = r.task;
+    index = r.index;
+    ++task->inflight;
+    return true;
+  }
+  return false;
+}
+
+// 按指数退避把摄像头放入延迟队列；退避后已来不及处理时返回 false
+bool InspectExecutor::schedule_retry_locked(const TaskPtr &task,
+                                            size_t index) {
+  int attempt = std::min(task->attempts[index], 16);
+  int64_t backoff = std::min<int64_t>(
+      static_cast<int64_t>(opts_.retry_backoff_ms) << attempt,
+      opts_.retry_backoff_max_ms);
+  auto ready_at = Clock::now() + std::chrono::milliseconds(backoff);
+  if (task->deadline - ready_at < min_budget_locked()) return false;
+  ++task->attempts[index];
+  ++retried_cameras_;
+  retries_.push(Retry{ready_at, task, index});
+  return true;
+}
+
+void InspectExecutor::dispatch_loop() {
+  while (true) {
+    TaskPtr task;
+    size_t index = 0;
+    int attempt = 0;
+    bool picked = false;
+    std::vector<TaskPtr> completed;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (!exit_) {
+        // 在途名额用满时等流水线返回结果
+        if (inflight_ >= opts_.max_inflight) {
+          cv_.wait(lock);
+          continue;
+        }
+        picked = pick_locked(task, index, completed);
+        if (picked || !completed.empty()) break;
+        // 等到最早的截止时间，以便及时丢弃排队中已超时的任务；
+        // 延迟队列中的重试到点时也要醒来（已到点的在等并发名额）
+        auto wake = Clock::time_point::max();
+        for (const auto &t : tasks_) {
+          if (t->next < t->cameras.size()) wake = std::min(wake, t->deadline);
+        }
+        if (!retries_.empty() && retries_.top().ready_at > Clock::now()) {
+          wake = std::min(wake, retries_.top().ready_at);
+        }
+        if (wake == Clock::time_point::max()) {
+          cv_.wait(lock);
+        } else {
+          cv_.wait_until(lock, wake);
+        }
+      }
+      if (exit_) break;
+      if (picked) {
+        ++inflight_;
+        attempt = task->attempts[index];
+      }
+    }
+    for (auto &t : completed) deliver(t);
+    if (!picked) continue;
+
+    const auto &cam = task->cameras[index];
+    // 截图与AI校验都不超过任务剩余时间；重试时必须实时截图，不能再取
+    // 刚校验过的缓存帧或常驻会话帧
+    CheckOptions opts;
+    opts.deadline = task->deadline;
+    opts.max_age_ms = cam.max_age_ms;
+    if (attempt > 0) opts = live_recapture_options(opts);
+    auto start = Clock::now();
+    check_(cam.camera_id, cam.rtsp_url, opts,
+           [this, task, index, attempt, start](json result) {
+             on_checked(task, index, attempt, start, std::move(result));
+           });
+  }
+}
+
+// 流水线返回一个摄像头的结果：可重试的放入延迟队列，否则计入任务完成
+void InspectExecutor::on_checked(const TaskPtr &task, size_t index,
+                                 int attempt, Clock::time_point start,
+                                 json result) {
+  result["camera_id"] = task->cameras[index].camera_id;
+  if (attempt > 0) result["attempts"] = attempt + 1;
+  bool retryable = opts_.retryable && opts_.retryable(result);
+  double elapsed_ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  bool task_done = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --inflight_;
+    avg_service_ms_ = avg_service_ms_ * 0.8 + elapsed_ms * 0.2;
+    task->results[index] = std::move(result);
+    --task->inflight;
+    if (attempt > 0 && !retryable) ++retry_recovered_;
+    bool delayed = retryable && attempt < opts_.retry_max_attempts &&
+                   schedule_retry_locked(task, index);
+    if (!delayed) {
+      if (retryable && opts_.retry_max_attempts > 0) ++retry_exhausted_;
+      task_done = ++task->finished == task->cameras.size();
+    }
+  }
+  // 释放了在途名额和该任务的并发名额，派发线程可能在等
+  cv_.notify_all();
+  if (task_done) deliver(task);
+}
+
+json InspectExecutor::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return json{{"max_inflight", opts_.max_inflight},
+              {"inflight", inflight_},
+              {"task_concurrency", opts_.task_concurrency},
+              {"queued_tasks", tasks_.size()},
+              {"queued_cameras", queued_cameras_},
+              {"max_queued_cameras", opts_.max_queued_cameras},
+              {"avg_service_ms", static_cast<int64_t>(avg_service_ms_)},
+              {"projected_wait_ms", projected_wait_ms_locked(queued_cameras_)},
+              {"dropped_cameras", dropped_cameras_},
+              {"rejected_tasks", rejected_tasks_},
+              {"folded_cameras", folded_cameras_},
+              {"delayed_retries", retries_.size()},
+              {"retried_cameras", retried_cameras_},
+              {"retry_recovered", retry_recovered_},
+              {"retry_exhausted", retry_exhausted_}};
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "inspect_impl.h"
+
+// 异步巡检执行器：派发线程按摄像头粒度把已提交任务的摄像头送入巡检
+// 流水线（异步的 CheckFn），同时在流水线中的摄像头数受 max_inflight 限制。
+// 调度按截止时间最早优先（EDF，截止时间 = 提交时间 + timeout），截止
+// 时间相同时优先在途摄像头少的任务，使多个任务交替推进；单个任务同时
+// 在途的摄像头数受 task_concurrency 限制。已经不可能在截止时间前完成
+// 的摄像头直接以408结束，不再送入流水线。同一任务中重复的摄像头
+// （camera_id与地址均相同）只处理一次，缓存时长取其中最严格的。任务全部
+// 摄像头完成后按请求顺序汇总结果回调 done。
+// 结果可重试（如AI未检测到目标）的摄像头按退避时间放入延迟队列，到点后
+// 重新派发、重新截图校验，等待期间不占用在途名额。
+class InspectExecutor {
+ public:
+  using Camera = InspectCamera;
+  // 结果回调，可在任意线程调用，每次检查恰好调用一次
+  using ResultFn = std::function<void(nlohmann::json result)>;
+  using CheckFn =
+      std::function<void(uint64_t camera_id, const std::string &rtsp_url,
+                         const CheckOptions &opts, ResultFn done)>;
+  using DoneFn = std::function<void(const std::string &task_id,
+                                    std::vector<nlohmann::json> results)>;
+
+  struct Options {
+    size_t max_inflight = 32;     // 同时在流水线中的摄像头数上限
+    size_t task_concurrency = 8;  // 单个任务的最大并行摄像头数
+    // 剩余时间不足平均单摄像头耗时的该比例时，视为无法按时完成而丢弃
+    double drop_ratio = 0.5;
+    size_t max_queued_cameras = 2000;  // 排队摄像头数上限，0表示不限
+    int retry_max_attempts = 0;  // 可重试结果最多重试的次数，0表示不重试
+    int retry_backoff_ms = 1000;      // 首次重试前的等待，之后每次翻倍
+    int retry_backoff_max_ms = 8000;  // 单次等待上限
+    // 判断结果是否可重试，为空时不重试
+    std::function<bool(const nlohmann::json &result)> retryable;
+  };
+
+  // 提交时的排队情况：排在该任务之前的摄像头数及预计等待时间；
+  // 排队摄像头数超过上限时 accepted 为 false，任务未入队
+  struct QueueInfo {
+    bool accepted = true;
+    size_t queue_depth = 0;
+    int64_t projected_wait_ms = 0;
+  };
+
+  InspectExecutor(const Options &opts, CheckFn check, DoneFn done);
+  ~InspectExecutor();
+  InspectExecutor(const InspectExecutor &) = delete;
+  InspectExecutor &operator=(const InspectExecutor &) = delete;
+
+  void start();
+  void stop();
+
+  // done 非空时该任务完成后回调它，而不是构造时传入的回调
+  QueueInfo submit(const std::string &task_id, std::vector<Camera> cameras,
+                   int timeout_sec, DoneFn done = nullptr);
+
+  // 当前整体排队情况（不提交任务）
+  QueueInfo queue_info();
+
+  // 排队摄像头数、忙碌线程数、预计等待时间等运行状态
+  nlohmann::json stats();
+
+ private:
+  struct Task {
+    std::string task_id;
+    std::vector<Camera> cameras;  // 去重后的摄像头
+    std::vector<size_t> slots;    // 请求中第i个摄像头对应 cameras 的下标
+    uint64_t seq = 0;  // 提交序号，截止时间与在途数都相同时先到先得
+    std::chrono::steady_clock::time_point deadline;
+    size_t next = 0;      // 下一个待派发的摄像头下标
+    size_t inflight = 0;  // 正在处理的摄像头数
+    size_t finished = 0;
+    std::vector<nlohmann::json> results;
+    std::vector<int> attempts;  // 各摄像头已重试的次数
+    DoneFn done;
+  };
+  using TaskPtr = std::shared_ptr<Task>;
+
+  // 延迟队列中等待重试的摄像头，ready_at 之前不派发
+  struct Retry {
+    std::chrono::steady_clock::time_point ready_at;
+    TaskPtr task;
+    size_t index = 0;
+  };
+  struct RetryLater {
+    bool operator()(const Retry &a, const Retry &b) const {
+      return a.ready_at > b.ready_at;
+    }
+  };
+
+  void dispatch_loop();
+  void on_checked(const TaskPtr &task, size_t index, int attempt,
+                  std::chrono::steady_clock::time_point start,
+                  nlohmann::json result);
+  bool pick_locked(TaskPtr &task, size_t &index,
+                   std::vector<TaskPtr> &completed);
+  bool pick_retry_locked(const TaskPtr &best, TaskPtr &task, size_t &index,
+                         std::vector<TaskPtr> &completed);
+  bool schedule_retry_locked(const TaskPtr &task, size_t index);
+  void drop_locked(const TaskPtr &task, const char *msg,
+                   std::vector<TaskPtr> &completed);
+  int64_t projected_wait_ms_locked(size_t cameras_ahead) const;
+  std::chrono::milliseconds min_budget_locked() const;
+  void deliver(const TaskPtr &task);
+
+  Options opts_;
+  CheckFn check_;
+  DoneFn done_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<TaskPtr> tasks_;  // 仍有摄像头待派发的任务
+  std::priority_queue<Retry, std::vector<Retry>, RetryLater> retries_;
+  uint64_t next_seq_ = 0;
+  size_t queued_cameras_ = 0;
+  size_t inflight_ = 0;  // 已送入流水线、尚未返回结果的摄像头数
+  double avg_service_ms_ = 2000;  // 单摄像头平均处理耗时（EWMA）
+  uint64_t dropped_cameras_ = 0;
+  uint64_t rejected_tasks_ = 0;
+  uint64_t folded_cameras_ = 0;  // 请求内重复而被合并的摄像头数
+  uint64_t retried_cameras_ = 0;    // 进入延迟队列重试的次数
+  uint64_t retry_recovered_ = 0;    // 重试后得到不可重试结果的次数
+  uint64_t retry_exhausted_ = 0;    // 次数或时间用尽仍以可重试结果结束
+  bool exit_ = false;
+  std::thread dispatcher_;
+};
@@ -2,25 +2,43 @@
 
 #include <uuid/uuid.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <filesystem>
 #include <fstream>
 #include <future>
+#include <map>
 #include <mutex>
 #include <queue>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
 
-#include "3rdparty/include/cpp-httplib/httplib.h"
-#include "3rdparty/include/cppcodec/cppcodec/base64_rfc4648.hpp"
 
+#include "ai_balancer.h"
+#include "ai_client.h"
+#include "ai_grpc_backend.h"
+#include "ai_guard.h"
+#include "camera_health.h"
+#include "delay_queue.h"
+#include "ffmpeg_pipe.h"
+#include "frame_analysis.h"
+#include "frame_cache.h"
+#include "frame_grabber.h"
+#include "frame_source.h"
+#include "inspect_executor.h"
+#include "pipeline_stage.h"
+#include "stream_session.h"
+#include "upstream_limiter.h"
+#include "utils/base64_utils.h"
 #include "utils/config_utils.h"
 #include "utils/http_utils.h"
 
 using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
 
 static std::string get_ffmpeg_path() {
   static std::string path = get_executable_dir() + "/ffmpeg";
@@ -41,176 +59,1260 @@ static std::unordered_map<std::string, std::chrono::steady_clock::time_point>
     g_inspect_time;
 static std::atomic<bool> g_cleaner_running{false};
 
-// 异步任务结构体
-struct InspectTask {
-  std::string task_id;
-  std::vector<std::pair<uint64_t, std::string>> cameras;
-  int timeout_sec;
+// 在途图片数据字节数：截图完成到AI校验结束之间持有的图片数据
+static std::atomic<size_t> g_inflight_image_bytes{0};
+static std::atomic<uint64_t> g_rejected_tasks{0};
+
+// 进行中的截图校验（按 camera_id+地址），供并发请求合并：首个请求的
+// 截止时间及等待其结果的回调（含首个请求自己的）
+using CheckDoneFn = std::function<void(json)>;
+struct InflightCheck {
+  Clock::time_point deadline;
+  bool force_live = false;  // 首个请求必须实时截图
+  std::vector<std::pair<CheckOptions, CheckDoneFn>> waiters;
+};
+static std::mutex g_inflight_check_mutex;
+static std::map<std::pair<uint64_t, std::string>, InflightCheck>
+    g_inflight_checks;
+static std::atomic<uint64_t> g_coalesced_checks{0};
+
+// 画面去重：每个摄像头上次送AI校验的画面指纹及其结论
+struct SceneEntry {
+  std::string rtsp_url;
+  uint64_t hash = 0;
+  json verdict;
+  Clock::time_point verified_at;
+};
+static std::mutex g_scene_mutex;
+static std::unordered_map<uint64_t, SceneEntry> g_scenes;
+static std::atomic<uint64_t> g_dedupe_checked{0};
+static std::atomic<uint64_t> g_dedupe_reused{0};
+static std::atomic<uint64_t> g_analysis_failures{0};
+
+// 画面质量预检计数
+static std::atomic<uint64_t> g_quality_checked{0};
+static std::atomic<uint64_t> g_quality_recaptured{0};
+static std::atomic<uint64_t> g_quality_dark{0};
+static std::atomic<uint64_t> g_quality_bright{0};
+static std::atomic<uint64_t> g_quality_flat{0};
+static std::atomic<uint64_t> g_quality_blurred{0};
+
+// 同步接口自动重试计数
+static std::atomic<uint64_t> g_sync_retried{0};    // 进入延迟队列重试的次数
+static std::atomic<uint64_t> g_sync_recovered{0};  // 重试后得到不可重试结果
+static std::atomic<uint64_t> g_sync_exhausted{0};  // 次数或时间用尽仍可重试
+static std::atomic<int64_t> g_sync_service_ms{0};  // 单次截图校验耗时 EWMA
+
+// 各摄像头已学到的流参数（libav截图），地址变化时作废
+struct LearnedStream {
+  std::string rtsp_url;
+  std::shared_ptr<const StreamProfile> profile;
 };
+static std::mutex g_stream_mutex;
+static std::unordered_map<uint64_t, LearnedStream> g_streams;
+static std::atomic<uint64_t> g_stream_fast_opens{0};
+static std::atomic<uint64_t> g_stream_full_probes{0};
+static std::atomic<uint64_t> g_stream_mismatches{0};
+
+// 连拍选帧计数
+static std::atomic<uint64_t> g_burst_captures{0};
+static std::atomic<uint64_t> g_burst_frames{0};
+static std::atomic<uint64_t> g_burst_improved{0};  // 选中的不是首帧
 
-static std::queue<InspectTask> g_task_queue;
-static std::mutex g_task_mutex;
-static std::condition_variable g_task_cv;
-static std::atomic<bool> g_task_thread_running{false};
-static std::atomic<bool> g_task_thread_exit{false};
+// 送AI校验的图片数与字节数
+static std::atomic<uint64_t> g_upload_images{0};
+static std::atomic<uint64_t> g_upload_bytes{0};
+
+// 每个摄像头最近一次校验结论，供状态墙等读多写少的查询直接返回
+struct VerdictEntry {
+  std::string rtsp_url;
+  json result;
+  Clock::time_point checked_at;
+  bool refreshing = false;  // 后台刷新进行中
+};
+static std::mutex g_verdict_mutex;
+static std::unordered_map<uint64_t, VerdictEntry> g_verdicts;
+static std::atomic<uint64_t> g_verdict_hits{0};
+static std::atomic<uint64_t> g_verdict_misses{0};
+static std::atomic<uint64_t> g_verdict_refreshes{0};
+
+struct InflightImageGuard {
+  explicit InflightImageGuard(size_t n) : bytes(n) {
+    g_inflight_image_bytes += n;
+  }
+  ~InflightImageGuard() { g_inflight_image_bytes -= bytes; }
+  size_t bytes;
+};
+
+static size_t get_max_inflight_image_bytes() {
+  return get_config().value("inspect_max_inflight_image_mb",
+                            static_cast<size_t>(256))
+         << 20;
+}
 
-// 辅助函数：调用ffmpeg截图，返回base64字符串
-static std::string capture_image_ffmpeg(const std::string &rtsp_url,
-                                        uint64_t camera_id) {
+// 单次截图的截止时间：capture_timeout_ms 与任务截止时间取较早者
+static Clock::time_point capture_deadline(Clock::time_point deadline) {
+  int timeout_ms = get_config().value("capture_timeout_ms", 10000);
+  return std::min(Clock::now() + std::chrono::milliseconds(timeout_ms),
+                  deadline);
+}
+
+// 各摄像头的感兴趣区域：camera_roi 为 {"camera_id": [x, y, w, h]}，
+// 按画面宽高归一化到 0~1，配置只读，启动后首次使用时解析一次
+static const std::unordered_map<uint64_t, FrameTransform> &get_camera_rois() {
+  static const std::unordered_map<uint64_t, FrameTransform> rois = []() {
+    std::unordered_map<uint64_t, FrameTransform> m;
+    const auto &conf = get_config();
+    auto it = conf.find("camera_roi");
+    if (it == conf.end() || !it->is_object()) return m;
+    for (const auto &[key, rect] : it->items()) {
+      bool valid = is_digits(key) && key.size() <= 19 && rect.is_array() &&
+                   rect.size() == 4;
+      for (size_t i = 0; valid && i < 4; ++i) {
+        valid = rect[i].is_number() && rect[i].get<double>() >= 0 &&
+                rect[i].get<double>() <= 1;
+      }
+      FrameTransform t;
+      if (valid) {
+        t.roi_x = rect[0].get<double>();
+        t.roi_y = rect[1].get<double>();
+        t.roi_w = rect[2].get<double>();
+        t.roi_h = rect[3].get<double>();
+        valid = t.has_roi() && t.roi_x + t.roi_w <= 1 &&
+                t.roi_y + t.roi_h <= 1;
+      }
+      if (!valid) {
+        spdlog::warn("camera_roi配置无效，已忽略: {}", key);
+        continue;
+      }
+      m[std::stoull(key)] = t;
+    }
+    return m;
+  }();
+  return rois;
+}
+
+// 辅助函数：送AI画面的裁剪缩放参数，ai_max_width/ai_max_height 限制
+// 输出分辨率（0为不限），配置了 camera_roi 的摄像头先裁出该区域
+static FrameTransform get_frame_transform(uint64_t camera_id) {
+  const auto &rois = get_camera_rois();
+  auto it = rois.find(camera_id);
+  FrameTransform t = it != rois.end() ? it->second : FrameTransform{};
+  t.max_width = get_config().value("ai_max_width", 0);
+  t.max_height = get_config().value("ai_max_height", 0);
+  return t;
+}
+
+// 辅助函数：调用ffmpeg可执行文件截图，JPEG数据写入jpeg
+static bool capture_jpeg_ffmpeg(const std::string &rtsp_url,
+                                uint64_t camera_id, Clock::time_point deadline,
+                                std::vector<uint8_t> &jpeg) {
   fs::create_directories(get_snapshot_dir());
   std::string out_path =
       get_snapshot_dir() + "/" + std::to_string(camera_id) + ".jpg";
-  std::stringstream cmd;
+  std::vector<std::string> args = {get_ffmpeg_path(), "-y", "-nostdin"};
   // 判断协议类型，rtsp支持-rtsp_transport tcp，http-flv不加该参数
   if (rtsp_url.find("rtsp://") == 0) {
-    cmd << get_ffmpeg_path() << " -y -rtsp_transport tcp -i '" << rtsp_url
-        << "' -frames:v 1 -q:v 2 -f image2 '" << out_path << "' 2>/dev/null";
-  } else {
-    cmd << get_ffmpeg_path() << " -y -i '" << rtsp_url
-        << "' -frames:v 1 -q:v 2 -f image2 '" << out_path << "' 2>/dev/null";
+    args.insert(args.end(), {"-rtsp_transport", "tcp"});
   }
-  int ret = std::system(cmd.str().c_str());
-  if (ret != 0) return "";
-  std::ifstream ifs(out_path, std::ios::binary);
-  std::vector<uint8_t> buffer(std::istreambuf_iterator<char>(ifs), {});
-  if (buffer.empty()) {
+  args.insert(args.end(), {"-i", rtsp_url, "-frames:v", "1"});
+  std::string vf = transform_filter(get_frame_transform(camera_id));
+  if (!vf.empty()) args.insert(args.end(), {"-vf", vf});
+  args.insert(args.end(),
+              {"-q:v", std::to_string(get_config().value("jpeg_quality", 2)),
+               "-f", "image2", out_path});
+  bool timed_out = false;
+  std::string err;
+  if (!run_ffmpeg(args, capture_deadline(deadline), nullptr, timed_out, err)) {
+    spdlog::warn("摄像头{}截图失败: {}", camera_id, err);
     fs::remove(out_path);
-    return "";
+    return false;
   }
-  std::string base64 = cppcodec::base64_rfc4648::encode(buffer);
+  std::ifstream ifs(out_path, std::ios::binary);
+  jpeg.assign(std::istreambuf_iterator<char>(ifs), {});
   fs::remove(out_path);
-  return base64;
+  return !jpeg.empty();
 }
 
-// POST图片到AI校验服务
-static json post_to_ai_service(const std::string &base64_img) {
+// 辅助函数：进程内libav截图，不落盘、不fork
+// 连拍选帧评分：亮度、对比度在质量预检阈值内的帧总是优先，其次比较
+// 清晰度（拉普拉斯方差，不超过 1020^2）。评分只用于相互比较，隔行取样
+static double burst_frame_score(const uint8_t *luma, int width, int height,
+                                int stride) {
   const auto &conf = get_config();
-  std::string host = conf.value("ai_service_host", "124.70.8.249");
-  int port = conf.value("ai_service_port", 1055);
-  httplib::Client cli(host, port);
-  json req_body = {{"image_base64", base64_img}};
-  auto res = cli.Post("/v1/eyes/exists", req_body.dump(), "application/json");
-  if (res && (res->status == 200 || res->status == 400)) {
-    return json::parse(res->body);
-  } else {
-    return json{{"code", 500}, {"msg", "AI服务请求失败"}};
+  FrameQuality q = measure_quality(luma, width, height / 2, stride * 2);
+  bool exposed =
+      q.brightness >= conf.value("quality_min_brightness", 16.0) &&
+      q.brightness <= conf.value("quality_max_brightness", 240.0) &&
+      q.contrast >= conf.value("quality_min_contrast", 8.0);
+  return exposed ? q.sharpness + 1020.0 * 1020.0 : q.sharpness;
+}
+
+static std::shared_ptr<const StreamProfile> find_stream_profile(
+    uint64_t camera_id, const std::string &rtsp_url) {
+  std::lock_guard<std::mutex> lock(g_stream_mutex);
+  auto it = g_streams.find(camera_id);
+  if (it == g_streams.end() || it->second.rtsp_url != rtsp_url) return nullptr;
+  return it->second.profile;
+}
+
+// 截图成功后更新该摄像头的流参数；旧参数对不上、或沿用旧参数却截图
+// 失败时作废，下次完整探测
+static void learn_stream_profile(uint64_t camera_id,
+                                 const std::string &rtsp_url,
+                                 const FrameGrabber &grabber, bool ok) {
+  std::lock_guard<std::mutex> lock(g_stream_mutex);
+  if (ok) {
+    g_streams[camera_id] = LearnedStream{
+        rtsp_url, std::make_shared<StreamProfile>(grabber.stream_profile())};
+  } else if (grabber.used_profile() || grabber.profile_mismatch()) {
+    g_streams.erase(camera_id);
   }
 }
 
-json capture_and_check(uint64_t camera_id, const std::string &rtsp_url) {
-  json resp;
-  if (rtsp_url.empty()) {
-    resp = {{"code", 1}, {"msg", "参数缺失"}};
-  } else {
-    std::string base64_img = capture_image_ffmpeg(rtsp_url, camera_id);
-    if (base64_img.empty()) {
-      resp = {{"code", 3}, {"msg", "截图失败"}};
-    } else {
-      json ai_result = post_to_ai_service(base64_img);
-      std::string ai_code = "-1";
-      std::string ai_msg = "AI服务未知错误";
-      if (ai_result.is_object() && ai_result.contains("code")) {
-        if (ai_result["code"].is_string()) {
-          ai_code = ai_result["code"];
-        } else if (ai_result["code"].is_number_integer()) {
-          ai_code = std::to_string(ai_result["code"].get<int>());
-        } else if (ai_result["code"].is_number_float()) {
-          ai_code = std::to_string(ai_result["code"].get<double>());
-        }
+static bool capture_jpeg_libav(const std::string &rtsp_url,
+                               uint64_t camera_id, Clock::time_point deadline,
+                               std::vector<uint8_t> &jpeg) {
+  const auto &conf = get_config();
+  FrameGrabber::Options opts;
+  opts.timeout_ms = conf.value("capture_timeout_ms", 10000);
+  opts.jpeg_quality = conf.value("jpeg_quality", 2);
+  opts.transform = get_frame_transform(camera_id);
+  opts.burst_frames = conf.value("capture_burst_frames", 1);
+  opts.burst_ms = conf.value("capture_burst_ms", 0);
+  opts.scorer = burst_frame_score;
+  opts.deadline = deadline;
+  bool learn = conf.value("capture_learn_stream_info", true);
+  if (learn) opts.profile = find_stream_profile(camera_id, rtsp_url);
+  FrameGrabber grabber(opts);
+  std::string err;
+  bool ok = grabber.grab_jpeg(rtsp_url, jpeg, err);
+  if (learn) {
+    if (grabber.profile_mismatch()) ++g_stream_mismatches;
+    if (grabber.used_profile()) {
+      ++g_stream_fast_opens;
+    } else if (ok) {
+      ++g_stream_full_probes;
+    }
+    learn_stream_profile(camera_id, rtsp_url, grabber, ok);
+  }
+  if (!ok) {
+    spdlog::warn("摄像头{}截图失败: {}", camera_id, err);
+    return false;
+  }
+  if (grabber.burst_decoded() > 1) {
+    ++g_burst_captures;
+    g_burst_frames += grabber.burst_decoded();
+    if (grabber.burst_picked() > 0) ++g_burst_improved;
+  }
+  return !jpeg.empty();
+}
+
+// 辅助函数：posix_spawn启动ffmpeg，经管道读回JPEG，不落盘
+static bool capture_jpeg_ffmpeg_pipe(const std::string &rtsp_url,
+                                     uint64_t camera_id,
+                                     Clock::time_point deadline,
+                                     std::vector<uint8_t> &jpeg) {
+  const auto &conf = get_config();
+  size_t reserve_bytes =
+      conf.value("capture_pipe_buffer_kb", static_cast<size_t>(512)) << 10;
+  bool timed_out = false;
+  std::string err;
+  if (!capture_jpeg_ffmpeg_pipe(
+          get_ffmpeg_path(), rtsp_url, conf.value("jpeg_quality", 2),
+          transform_filter(get_frame_transform(camera_id)), reserve_bytes,
+          capture_deadline(deadline), jpeg, timed_out, err)) {
+    spdlog::warn("摄像头{}截图失败: {}", camera_id, err);
+    return false;
+  }
+  return true;
+}
+
+// 常驻拉流会话池（session_pool_enable开启时使用）
+static StreamSessionPool *get_session_pool() {
+  static std::unique_ptr<StreamSessionPool> pool = []() {
+    const auto &conf = get_config();
+    std::unique_ptr<StreamSessionPool> p;
+    if (!conf.value("session_pool_enable", false)) return p;
+    StreamSessionPool::Options opts;
+    opts.idle_ttl_sec = conf.value("session_idle_ttl_sec", 300);
+    opts.promote_hits = conf.value("session_promote_hits", 2);
+    opts.promote_window_sec = conf.value("session_promote_window_sec", 600);
+    opts.max_frame_age_ms = conf.value("session_max_frame_age_ms", 5000);
+    opts.open_timeout_ms = conf.value("capture_timeout_ms", 10000);
+    opts.jpeg_quality = conf.value("jpeg_quality", 2);
+    opts.max_sessions = conf.value("session_max_sessions", 200);
+    opts.max_memory_bytes =
+        conf.value("session_max_memory_mb", static_cast<size_t>(1024)) << 20;
+    p = std::make_unique<StreamSessionPool>(opts);
+    return p;
+  }();
+  return pool.get();
+}
+
+// 辅助函数：按配置capture_mode截图，须在deadline前完成
+// capture_mode: libav(默认，进程内解码) / ffmpeg_pipe(posix_spawn+管道)
+//               / ffmpeg(调用ffmpeg可执行文件并落盘)
+static bool capture_jpeg(const std::string &rtsp_url, uint64_t camera_id,
+                         Clock::time_point deadline,
+                         std::vector<uint8_t> &jpeg) {
+  std::string mode = get_config().value("capture_mode", "libav");
+  if (mode == "ffmpeg") {
+    return capture_jpeg_ffmpeg(rtsp_url, camera_id, deadline, jpeg);
+  }
+  if (mode == "ffmpeg_pipe") {
+    return capture_jpeg_ffmpeg_pipe(rtsp_url, camera_id, deadline, jpeg);
+  }
+  return capture_jpeg_libav(rtsp_url, camera_id, deadline, jpeg);
+}
+
+// 截图缓存（frame_cache_max_mb 为0时关闭）
+static FrameCache *get_frame_cache() {
+  static std::unique_ptr<FrameCache> cache = []() {
+    size_t max_mb =
+        get_config().value("frame_cache_max_mb", static_cast<size_t>(256));
+    std::unique_ptr<FrameCache> c;
+    if (max_mb > 0) c = std::make_unique<FrameCache>(max_mb << 20);
+    return c;
+  }();
+  return cache.get();
+}
+
+// 摄像头健康登记，首次使用时按配置创建
+static CameraHealth &camera_health_registry() {
+  static CameraHealth health([]() {
+    const auto &conf = get_config();
+    CameraHealth::Options opts;
+    opts.fail_threshold = conf.value("health_fail_threshold", 3);
+    opts.backoff_base_ms = conf.value("health_backoff_base_ms", 5000);
+    opts.backoff_max_ms = conf.value("health_backoff_max_ms", 300000);
+    opts.timeout_factor = conf.value("health_timeout_factor", 2.0);
+    opts.min_timeout_ms = conf.value("health_min_timeout_ms", 2000);
+    opts.max_timeout_ms = conf.value("capture_timeout_ms", 10000);
+    return opts;
+  }());
+  return health;
+}
+
+// 截图上游（NVR、流媒体服务器）限流，首次使用时按配置创建
+static UpstreamLimiter &upstream_limiter() {
+  static UpstreamLimiter limiter([]() {
+    const auto &conf = get_config();
+    auto parse_limit = [](const json &j, UpstreamLimiter::Limit limit) {
+      limit.max_concurrent = j.value("max_concurrent", limit.max_concurrent);
+      limit.rate_per_sec = j.value("rate_per_sec", limit.rate_per_sec);
+      limit.burst = j.value("burst", limit.burst);
+      return limit;
+    };
+    UpstreamLimiter::Options opts;
+    opts.per_host.max_concurrent =
+        conf.value("capture_host_max_concurrent", static_cast<size_t>(0));
+    opts.per_host.rate_per_sec = conf.value("capture_host_rate_per_sec", 0.0);
+    opts.per_host.burst = conf.value("capture_host_burst", 1.0);
+    // 形如 {"nvr-a": {"max_concurrent": 4}, "10.0.0.8:8554": {...}}，
+    // 未写的字段取默认限制
+    auto it = conf.find("capture_host_limits");
+    if (it != conf.end() && it->is_object()) {
+      for (const auto &[key, value] : it->items()) {
+        if (!value.is_object()) continue;
+        std::string upstream = key;
+        std::transform(upstream.begin(), upstream.end(), upstream.begin(),
+                       ::tolower);
+        opts.overrides[upstream] = parse_limit(value, opts.per_host);
       }
-      if (ai_result.is_object() && ai_result.contains("msg")) {
-        if (ai_result["msg"].is_string()) {
-          ai_msg = ai_result["msg"];
+    }
+    return opts;
+  }());
+  return limiter;
+}
+
+// 辅助函数：按 frame_sources 的顺序取画面——调用方允许时先取足够新的
+// 缓存帧，开启常驻会话池时其次取最新帧；都没有或 force_live 时返回
+// false，需要实时截图。source 为画面来源，会话帧时 frame_seq 为帧序号
+static bool cached_image(const std::string &rtsp_url, uint64_t camera_id,
+                         const CheckOptions &opts, std::vector<uint8_t> &jpeg,
+                         FrameSource &source, uint64_t &frame_seq) {
+  FrameCache *cache = get_frame_cache();
+  StreamSessionPool *pool = get_session_pool();
+  CacheFetchFn from_cache;
+  if (cache) {
+    from_cache = [&]() {
+      return cache->get(camera_id, rtsp_url, opts.max_age_ms, jpeg);
+    };
+  }
+  SessionFetchFn from_session;
+  if (pool) {
+    from_session = [&](uint64_t &seq) {
+      return pool->get_latest_jpeg(camera_id, rtsp_url,
+                                   get_frame_transform(camera_id), jpeg, &seq);
+    };
+  }
+  source = fetch_frame(opts, from_cache, from_session, frame_seq);
+  return source != FrameSource::kLive;
+}
+
+// 实时截图前先查健康登记：已知离线、仍在退避期的摄像头直接失败，
+// resp 给出 {"code":5,...}
+static bool admit_live_capture(uint64_t camera_id, json &resp) {
+  int64_t retry_after_ms = 0;
+  if (camera_health_registry().admit(camera_id, retry_after_ms)) return true;
+  resp = {{"code", 5},
+          {"msg", "摄像头连续截图失败，暂停截图"},
+          {"retry_after_ms", retry_after_ms}};
+  return false;
+}
+
+// 辅助函数：实时截图得到JPEG，截图超时按该摄像头历史耗时自适应。
+// 调用方须已通过 admit_live_capture 与上游限流；通过质量预检后才写入缓存
+static bool capture_live(const std::string &rtsp_url, uint64_t camera_id,
+                         const CheckOptions &opts,
+                         std::vector<uint8_t> &jpeg) {
+  CameraHealth &health = camera_health_registry();
+  auto start = Clock::now();
+  auto deadline = std::min(
+      opts.deadline,
+      start + std::chrono::milliseconds(health.capture_timeout_ms(camera_id)));
+  if (!capture_jpeg(rtsp_url, camera_id, deadline, jpeg)) {
+    // 任务截止时间到了导致的失败说明不了摄像头的状况，不计入
+    if (Clock::now() < opts.deadline) health.record_failure(camera_id);
+    return false;
+  }
+  health.record_success(
+      camera_id,
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+  return true;
+}
+
+// AI服务副本列表：ai_service_endpoints 形如 ["10.0.0.1:1055", ...]，
+// 未配置时为 ai_service_host/ai_service_port 单个副本。副本共用其余设置
+static const std::vector<AiClient::Options> &get_ai_endpoints() {
+  static const std::vector<AiClient::Options> endpoints = []() {
+    const auto &conf = get_config();
+    AiClient::Options opts;
+    opts.host = conf.value("ai_service_host", opts.host);
+    opts.port = conf.value("ai_service_port", opts.port);
+    opts.path = conf.value("ai_service_path", opts.path);
+    opts.tls = conf.value("ai_service_tls", false);
+    opts.tls_verify = conf.value("ai_service_tls_verify", true);
+    opts.tls_session_resumption =
+        conf.value("ai_service_tls_session_resumption", true);
+    opts.connect_timeout_ms = conf.value("ai_connect_timeout_ms", 3000);
+    opts.read_timeout_ms = conf.value("ai_read_timeout_ms", 30000);
+    opts.pool_size = conf.value("ai_pool_size", static_cast<size_t>(16));
+    std::vector<AiClient::Options> endpoints;
+    auto it = conf.find("ai_service_endpoints");
+    if (it != conf.end() && it->is_array()) {
+      for (const auto &item : *it) {
+        if (!item.is_string()) continue;
+        std::string endpoint = item.get<std::string>();
+        size_t colon = endpoint.rfind(':');
+        std::string port = colon == std::string::npos
+                               ? std::string()
+                               : endpoint.substr(colon + 1);
+        if (port.empty() || !is_digits(port) || port.size() > 5) {
+          spdlog::warn("忽略无效的AI服务地址: {}", endpoint);
+          continue;
         }
+        endpoints.push_back(opts);
+        endpoints.back().host = endpoint.substr(0, colon);
+        endpoints.back().port = std::stoi(port);
+      }
+    }
+    if (endpoints.empty()) endpoints.push_back(opts);
+    return endpoints;
+  }();
+  return endpoints;
+}
+
+// AI校验后端是否为gRPC流（ai_backend: rest(默认) / grpc）
+static bool ai_backend_is_grpc() {
+  static const bool grpc = get_config().value("ai_backend", "rest") == "grpc";
+  return grpc;
+}
+
+// AI校验后端，首次使用时按配置创建：rest 为多副本选择与对冲的HTTP客户端，
+// grpc 为与推理服务之间的单条双向流
+static AiBackend &get_ai_backend() {
+  static const std::unique_ptr<AiBackend> backend =
+      []() -> std::unique_ptr<AiBackend> {
+    const auto &conf = get_config();
+    if (ai_backend_is_grpc()) {
+      AiGrpcBackend::Options opts;
+      opts.target = conf.value("ai_grpc_target", opts.target);
+      opts.tls = conf.value("ai_grpc_tls", false);
+      opts.connect_timeout_ms = conf.value("ai_connect_timeout_ms", 3000);
+      opts.reconnect_backoff_ms = conf.value("ai_grpc_reconnect_ms", 1000);
+      opts.keepalive_ms = conf.value("ai_grpc_keepalive_ms", 10000);
+      opts.write_timeout_ms = conf.value("ai_grpc_write_timeout_ms", 5000);
+      opts.max_inflight =
+          conf.value("ai_grpc_max_inflight", static_cast<size_t>(64));
+      return std::make_unique<AiGrpcBackend>(opts);
+    }
+    AiBalancer::Options opts;
+    opts.endpoints = get_ai_endpoints();
+    opts.fail_threshold = conf.value("ai_endpoint_fail_threshold", 3);
+    opts.cooldown_ms = conf.value("ai_endpoint_cooldown_ms", 10000);
+    opts.health_path = conf.value("ai_health_path", "");
+    opts.health_interval_ms = conf.value("ai_health_interval_ms", 5000);
+    opts.hedge = conf.value("ai_hedge_enable", false);
+    opts.hedge_percentile = conf.value("ai_hedge_percentile", 0.95);
+    opts.hedge_min_delay_ms = conf.value("ai_hedge_min_delay_ms", 50);
+    return std::make_unique<AiBalancer>(opts);
+  }();
+  return *backend;
+}
+
+// AI服务调用保护（自适应并发上限与熔断），首次使用时按配置创建
+static AiGuard &ai_guard() {
+  static AiGuard guard([]() {
+    const auto &conf = get_config();
+    AiGuard::Options opts;
+    opts.adaptive = conf.value("ai_adaptive_concurrency", true);
+    opts.min_limit = conf.value("ai_min_concurrency", static_cast<size_t>(1));
+    opts.max_limit = get_ai_backend().max_concurrency();
+    opts.latency_tolerance = conf.value("ai_latency_tolerance", 2.0);
+    opts.breaker_failures = conf.value("ai_breaker_failures", 5);
+    opts.breaker_window =
+        conf.value("ai_breaker_window", static_cast<size_t>(20));
+    opts.breaker_failure_ratio = conf.value("ai_breaker_failure_ratio", 0.5);
+    opts.breaker_open_ms = conf.value("ai_breaker_open_ms", 5000);
+    opts.breaker_open_max_ms = conf.value("ai_breaker_open_max_ms", 60000);
+    return opts;
+  }());
+  return guard;
+}
+
+// AI服务熔断中的返回
+static json ai_unavailable(int64_t retry_after_ms) {
+  return {{"code", 6},
+          {"msg", "AI服务异常，暂停校验"},
+          {"retry_after_ms", retry_after_ms}};
+}
+
+// POST图片到AI校验服务，连接/读超时不超过deadline剩余时间
+// ai_upload_mode: base64_json(默认) / binary(application/octet-stream)
+//                 / multipart(multipart/form-data)
+// binary、multipart 模式直接从截图缓冲写入socket，不做base64和拷贝；
+// 截图缓冲移入请求，对冲时两份请求共用。gRPC后端不受 ai_upload_mode
+// 影响，始终发送JPEG原始字节
+static json post_to_ai_service(std::vector<uint8_t> jpeg,
+                               Clock::time_point deadline) {
+  const auto &conf = get_config();
+  std::string mode = conf.value("ai_upload_mode", "base64_json");
+  ++g_upload_images;
+  g_upload_bytes += jpeg.size();
+  auto req = std::make_shared<AiRequest>();
+  if (ai_backend_is_grpc()) {
+    req->content_type = "image/jpeg";
+    req->image = std::move(jpeg);
+  } else if (mode == "binary") {
+    req->content_type = "application/octet-stream";
+    req->image = std::move(jpeg);
+  } else if (mode == "multipart") {
+    std::string boundary = "----edgeservice" + generate_uuid();
+    req->content_type = "multipart/form-data; boundary=" + boundary;
+    req->head = "--" + boundary +
+                "\r\nContent-Disposition: form-data; name=\"" +
+                conf.value("ai_upload_field", "image") +
+                "\"; filename=\"snapshot.jpg\"\r\n"
+                "Content-Type: image/jpeg\r\n\r\n";
+    req->image = std::move(jpeg);
+    req->tail = "\r\n--" + boundary + "--\r\n";
+  } else {
+    req->content_type = "application/json";
+    req->head =
+        make_base64_json_body("image_base64", jpeg.data(), jpeg.size());
+  }
+  return get_ai_backend().post(std::move(req), deadline);
+}
+
+// 记录校验结论；调用方截止时间导致的超时与AI服务熔断不代表摄像头
+// 状态，不记录
+static void record_verdict(uint64_t camera_id, const std::string &rtsp_url,
+                           const json &resp) {
+  if (resp.contains("code") && (resp["code"] == 408 || resp["code"] == 6)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(g_verdict_mutex);
+  VerdictEntry &e = g_verdicts[camera_id];
+  e.rtsp_url = rtsp_url;
+  e.result = resp;
+  e.checked_at = Clock::now();
+}
+
+// AI服务结果码统一为字符串：AI服务可能以字符串或数字返回 code，
+// 缺失时为 "-1"
+static std::string ai_code_of(const json &ai_result) {
+  if (ai_result.is_object() && ai_result.contains("code")) {
+    const json &code = ai_result["code"];
+    if (code.is_string()) return code.get<std::string>();
+    if (code.is_number_integer()) return std::to_string(code.get<int>());
+    if (code.is_number_float()) return std::to_string(code.get<double>());
+  }
+  return "-1";
+}
+
+// AI服务结果转换为接口返回：100000原样返回，200220可重试，其余转为整数码
+static json map_ai_result(const json &ai_result) {
+  std::string ai_code = ai_code_of(ai_result);
+  std::string ai_msg = "AI服务未知错误";
+  if (ai_result.is_object() && ai_result.contains("msg")) {
+    if (ai_result["msg"].is_string()) {
+      ai_msg = ai_result["msg"];
+    }
+  }
+  if (ai_code == "100000") {
+    return ai_result;
+  } else if (ai_code == "200220") {
+    return {{"code", 200220}, {"msg", "AI未检测到目标(可重试)"}};
+  }
+  int code_int = -1;
+  if (is_digits(ai_code)) {
+    try {
+      code_int = std::stoi(ai_code);
+    } catch (...) {
+      code_int = -1;
+    }
+  }
+  return {{"code", code_int}, {"msg", ai_msg}};
+}
+
+// 截图本地分析的结果
+struct FrameAnalysis {
+  bool hashed = false;
+  uint64_t hash = 0;  // dHash指纹，hashed为true时有效
+};
+
+// 画面质量预检：过暗、过亮、无内容（灰屏/纯色）、模糊时拒绝，
+// resp 为拒绝原因（code 4）及各项指标
+static bool check_frame_quality(const LumaImage &luma, json &resp) {
+  const auto &conf = get_config();
+  ++g_quality_checked;
+  FrameQuality q = measure_quality(luma);
+  const char *reason = nullptr;
+  if (q.brightness < conf.value("quality_min_brightness", 16.0)) {
+    reason = "画面过暗";
+    ++g_quality_dark;
+  } else if (q.brightness > conf.value("quality_max_brightness", 240.0)) {
+    reason = "画面过亮";
+    ++g_quality_bright;
+  } else if (q.contrast < conf.value("quality_min_contrast", 8.0)) {
+    reason = "画面无内容";
+    ++g_quality_flat;
+  } else if (q.sharpness < conf.value("quality_min_sharpness", 20.0)) {
+    reason = "画面模糊";
+    ++g_quality_blurred;
+  }
+  if (!reason) return true;
+  resp = {{"code", 4},
+          {"msg", std::string("画面质量不合格: ") + reason},
+          {"quality",
+           {{"brightness", q.brightness},
+            {"contrast", q.contrast},
+            {"sharpness", q.sharpness}}}};
+  return false;
+}
+
+// 截图的本地分析：按需解码亮度平面，计算dHash指纹（dedupe_hamming_threshold
+// 大于0时）并做质量预检（quality_check_enable时）。质量不合格返回false，
+// 解码失败不拦截，照常送AI校验
+static bool analyze_frame(uint64_t camera_id, const std::vector<uint8_t> &jpeg,
+                          FrameAnalysis &fa, json &resp) {
+  const auto &conf = get_config();
+  bool dedupe = conf.value("dedupe_hamming_threshold", 0) > 0;
+  bool quality = conf.value("quality_check_enable", false);
+  if (!dedupe && !quality) return true;
+  // 指纹只需 9x8，只做去重时按1/8缩小解码；质量预检按配置缩小
+  int lowres = quality ? conf.value("quality_decode_lowres", 1) : 3;
+  LumaImage luma;
+  std::string err;
+  if (!decode_jpeg_luma(jpeg, lowres, luma, err)) {
+    ++g_analysis_failures;
+    spdlog::warn("摄像头{}截图分析失败: {}", camera_id, err);
+    return true;
+  }
+  if (dedupe) {
+    ++g_dedupe_checked;
+    fa.hashed = dhash64(luma, fa.hash);
+  }
+  return !quality || check_frame_quality(luma, resp);
+}
+
+// 画面与上次送AI校验的画面指纹足够接近、且该结论未超过复用时长时，
+// 复用该结论。与"上次校验的画面"而不是"上一帧"比较，避免缓慢变化
+// 逐帧累积却一直复用旧结论
+static bool reuse_scene_verdict(uint64_t camera_id, const std::string &rtsp_url,
+                                uint64_t hash, json &resp) {
+  const auto &conf = get_config();
+  int threshold = conf.value("dedupe_hamming_threshold", 0);
+  auto max_reuse =
+      std::chrono::seconds(conf.value("dedupe_max_reuse_sec", 300));
+  std::lock_guard<std::mutex> lock(g_scene_mutex);
+  auto it = g_scenes.find(camera_id);
+  if (it == g_scenes.end() || it->second.rtsp_url != rtsp_url ||
+      Clock::now() - it->second.verified_at > max_reuse) {
+    return false;
+  }
+  int distance = hamming_distance(hash, it->second.hash);
+  if (distance >= threshold) return false;
+  resp = it->second.verdict;
+  resp["reused"] = true;
+  resp["hash_distance"] = distance;
+  ++g_dedupe_reused;
+  return true;
+}
+
+// 记录送AI校验的画面指纹及其成功结论，供后续复用
+static void remember_scene_verdict(uint64_t camera_id,
+                                   const std::string &rtsp_url, uint64_t hash,
+                                   const json &resp) {
+  std::lock_guard<std::mutex> lock(g_scene_mutex);
+  if (ai_code_of(resp) != "100000") {
+    g_scenes.erase(camera_id);
+    return;
+  }
+  SceneEntry &e = g_scenes[camera_id];
+  e.rtsp_url = rtsp_url;
+  e.hash = hash;
+  e.verdict = resp;
+  e.verified_at = Clock::now();
+}
+
+// 巡检流水线的四个阶段：截图（含编码）、预处理（画面分析、去重）、
+// AI校验、结果汇总。各阶段线程数与队列上限分别配置，首次使用时创建
+enum class Stage { kCapture, kPreprocess, kVerify, kResult };
+
+static PipelineStage &pipeline_stage(Stage stage) {
+  static const std::array<std::unique_ptr<PipelineStage>, 4> stages = []() {
+    const auto &conf = get_config();
+    size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    size_t ai_pool = get_ai_backend().max_concurrency();
+    auto make = [&conf](const char *name, size_t concurrency) {
+      std::string key = std::string("pipeline_") + name;
+      PipelineStage::Options opts;
+      opts.name = name;
+      opts.concurrency = conf.value(key + "_concurrency", concurrency);
+      opts.max_queue =
+          conf.value(key + "_max_queue", static_cast<size_t>(256));
+      return std::make_unique<PipelineStage>(opts);
+    };
+    return std::array<std::unique_ptr<PipelineStage>, 4>{
+        make("capture", 16), make("preprocess", cores),
+        make("verify", ai_pool), make("result", 2)};
+  }();
+  return *stages[static_cast<size_t>(stage)];
+}
+
+// 一次截图校验在各阶段之间传递的状态
+struct CheckJob {
+  uint64_t camera_id = 0;
+  std::string rtsp_url;
+  CheckOptions opts;          // 调用方的截止时间与缓存要求
+  CheckOptions capture_opts;  // 质量重截时改为必须实时截图
+  int recaptures = 0;
+  bool captured = false;
+  bool verified = false;
+  FrameSource source = FrameSource::kLive;  // 本次画面的来源
+  uint64_t frame_seq = 0;  // 会话帧序号，质量不合格时据此作废
+  std::vector<uint8_t> jpeg;
+  std::unique_ptr<InflightImageGuard> inflight;  // 截图完成到AI校验结束
+  FrameAnalysis fa;
+  json ai_result;
+  json resp;
+  CheckDoneFn done;
+};
+using CheckJobPtr = std::shared_ptr<CheckJob>;
+
+// 把任务送入某一阶段；阶段内抛出异常时以500结束，保证 done 一定被调用
+static void run_stage(Stage stage, const CheckJobPtr &job,
+                      void (*fn)(const CheckJobPtr &), bool force = false);
+
+// 送入结果阶段。force 时不受结果阶段队列上限约束，供不能阻塞的线程
+// （如上游限流的调度线程）使用
+static void finish_check(const CheckJobPtr &job, bool force = false) {
+  run_stage(Stage::kResult, job, [](const CheckJobPtr &job) {
+    if (job->verified) {
+      job->resp = map_ai_result(job->ai_result);
+      if (job->fa.hashed) {
+        remember_scene_verdict(job->camera_id, job->rtsp_url, job->fa.hash,
+                               job->resp);
       }
-      if (ai_code == "100000") {
-        resp = ai_result;
-      } else if (ai_code == "200220") {
-        resp = {{"code", 200220}, {"msg", "AI未检测到目标(可重试)"}};
+    } else if (!job->captured && job->resp.is_null()) {
+      if (Clock::now() >= job->opts.deadline) {
+        job->resp = {{"code", 408}, {"msg", "截图超时"}};
       } else {
-        int code_int = -1;
-        if (is_digits(ai_code)) {
-          try {
-            code_int = std::stoi(ai_code);
-          } catch (...) {
-            code_int = -1;
-          }
-        }
-        resp = {{"code", code_int}, {"msg", ai_msg}};
+        job->resp = {{"code", 3}, {"msg", "截图失败"}};
       }
     }
-  }
-  return resp;
+    record_verdict(job->camera_id, job->rtsp_url, job->resp);
+    auto done = std::move(job->done);
+    done(std::move(job->resp));
+  }, force);
 }
 
-// 后台任务处理线程
-void start_inspect_task_worker() {
-  if (g_task_thread_running.exchange(true)) return;
-  g_task_thread_exit = false;
-  std::thread([]() {
-    while (true) {
-      InspectTask task;
-      {
-        std::unique_lock<std::mutex> lock(g_task_mutex);
-        g_task_cv.wait(
-            lock, [] { return g_task_thread_exit || !g_task_queue.empty(); });
-        if (g_task_thread_exit && g_task_queue.empty()) break;
-        if (g_task_queue.empty()) continue;
-        task = g_task_queue.front();
-        g_task_queue.pop();
+static void verify_stage(const CheckJobPtr &job) {
+  AiGuard &guard = ai_guard();
+  AiGuard::Permit permit;
+  int64_t retry_after_ms = 0;
+  switch (guard.acquire(job->opts.deadline, permit, retry_after_ms)) {
+    case AiGuard::Admit::kOpen:
+      job->resp = ai_unavailable(retry_after_ms);
+      break;
+    case AiGuard::Admit::kTimeout:
+      job->resp = {{"code", 408}, {"msg", "等待AI服务并发名额超时"}};
+      break;
+    case AiGuard::Admit::kOk: {
+      // 名额在任何情况下都要归还；调用中抛出异常按服务异常计入熔断
+      struct Release {
+        AiGuard &guard;
+        const AiGuard::Permit &permit;
+        AiGuard::Outcome outcome;
+        ~Release() { guard.release(permit, outcome); }
+      } release{guard, permit, AiGuard::Outcome::kFailure};
+      // 请求拿到的时间：不足AI请求超时的408是调用方截止时间过短，
+      // 不作为AI服务过载的信号
+      auto budget = std::chrono::milliseconds::max();
+      if (job->opts.deadline != Clock::time_point::max()) {
+        budget = std::chrono::duration_cast<std::chrono::milliseconds>(
+            job->opts.deadline - Clock::now());
       }
-      // 处理任务
-      json resp;
-      std::vector<json> results;
-      auto start = std::chrono::steady_clock::now();
-      for (const auto &cam : task.cameras) {
-        uint64_t camera_id = cam.first;
-        const std::string &rtsp_url = cam.second;
-        auto now = std::chrono::steady_clock::now();
-        int remain =
-            task.timeout_sec -
-            std::chrono::duration_cast<std::chrono::seconds>(now - start)
-                .count();
-        if (remain <= 0) {
-          results.push_back(
-              {{"code", 408}, {"msg", "轮检超时"}, {"camera_id", camera_id}});
-          continue;
+      auto ai_timeout = std::chrono::milliseconds(
+          get_config().value("ai_read_timeout_ms", 30000));
+      try {
+        job->ai_result =
+            post_to_ai_service(std::move(job->jpeg), job->opts.deadline);
+        release.outcome =
+            AiGuard::outcome_of(job->ai_result, budget, ai_timeout);
+        job->verified = true;
+      } catch (const std::exception &e) {
+        spdlog::error("摄像头{}调用AI服务异常: {}", job->camera_id, e.what());
+        job->resp = {{"code", 500}, {"msg", "AI校验内部错误"}};
+      }
+      break;
+    }
+  }
+  job->jpeg = std::vector<uint8_t>();
+  job->inflight.reset();
+  finish_check(job);
+}
+
+static void capture_stage(const CheckJobPtr &job);
+
+static void preprocess_stage(const CheckJobPtr &job) {
+  job->fa = FrameAnalysis();
+  if (!analyze_frame(job->camera_id, job->jpeg, job->fa, job->resp)) {
+    // 不合格的会话帧作废，其他请求不会再取到它
+    if (job->source == FrameSource::kSession) {
+      get_session_pool()->reject_frame(job->camera_id, job->frame_seq);
+    }
+    int recapture = get_config().value("quality_recapture", 1);
+    if (job->recaptures < recapture && Clock::now() < job->opts.deadline) {
+      // 质量不合格且时间允许：重新实时截图，缓存帧与会话帧都不再用
+      ++job->recaptures;
+      ++g_quality_recaptured;
+      job->capture_opts = live_recapture_options(job->opts);
+      job->inflight.reset();
+      run_stage(Stage::kCapture, job, capture_stage, true);
+      return;
+    }
+    finish_check(job);
+    return;
+  }
+  // 只缓存通过质量预检的实时截图
+  if (job->source == FrameSource::kLive) {
+    FrameCache *cache = get_frame_cache();
+    if (cache) cache->put(job->camera_id, job->rtsp_url, job->jpeg);
+  }
+  // 画面未变化时复用上次结论，不再调用AI服务
+  if (job->fa.hashed && reuse_scene_verdict(job->camera_id, job->rtsp_url,
+                                            job->fa.hash, job->resp)) {
+    finish_check(job);
+    return;
+  }
+  run_stage(Stage::kVerify, job, verify_stage);
+}
+
+static void captured_image(const CheckJobPtr &job) {
+  job->captured = true;
+  job->inflight = std::make_unique<InflightImageGuard>(job->jpeg.size());
+  run_stage(Stage::kPreprocess, job, preprocess_stage);
+}
+
+// 上游限流放行后的实时截图，结束即归还名额
+static void live_capture_stage(const CheckJobPtr &job) {
+  struct Release {
+    const std::string &url;
+    ~Release() { upstream_limiter().release(url); }
+  } release{job->rtsp_url};
+  if (!capture_live(job->rtsp_url, job->camera_id, job->capture_opts,
+                    job->jpeg)) {
+    finish_check(job);
+    return;
+  }
+  job->source = FrameSource::kLive;
+  job->frame_seq = 0;
+  captured_image(job);
+}
+
+// AI服务熔断中时截了图也无法校验，直接失败；缓存帧可用时直接进入
+// 预处理；否则排队等所在主机的截图名额，等待期间不占用截图线程，其他
+// 主机上的摄像头照常截图
+static void capture_stage(const CheckJobPtr &job) {
+  int64_t retry_after_ms = 0;
+  if (ai_guard().is_open(retry_after_ms)) {
+    job->resp = ai_unavailable(retry_after_ms);
+    finish_check(job);
+    return;
+  }
+  if (cached_image(job->rtsp_url, job->camera_id, job->capture_opts,
+                   job->jpeg, job->source, job->frame_seq)) {
+    captured_image(job);
+    return;
+  }
+  if (!admit_live_capture(job->camera_id, job->resp)) {
+    finish_check(job);
+    return;
+  }
+  // 回调在限流调度线程上执行，只投递任务、不阻塞，否则会拖住其他主机的放行
+  upstream_limiter().acquire(
+      job->rtsp_url, job->opts.deadline, [job](bool admitted) {
+        if (!admitted) {
+          finish_check(job, true);
+          return;
         }
-        // 单摄像头处理
-        json one_result = capture_and_check(camera_id, rtsp_url);
-        one_result["camera_id"] = camera_id;
-        results.push_back(one_result);
+        run_stage(Stage::kCapture, job, live_capture_stage, true);
+      });
+}
+
+static void run_stage(Stage stage, const CheckJobPtr &job,
+                      void (*fn)(const CheckJobPtr &), bool force) {
+  pipeline_stage(stage).submit(
+      [job, fn]() {
+        try {
+          fn(job);
+        } catch (const std::exception &e) {
+          spdlog::error("摄像头{}巡检异常: {}", job->camera_id, e.what());
+          if (!job->done) return;
+          auto done = std::move(job->done);
+          done(json{{"code", 500}, {"msg", "巡检内部错误"}});
+        }
+      },
+      force);
+}
+
+// 单个摄像头截图并AI校验，结果经流水线异步回调 done。
+// force 时不受截图阶段队列上限约束（由流水线线程发起时使用）
+static void check_camera(uint64_t camera_id, const std::string &rtsp_url,
+                         const CheckOptions &opts, CheckDoneFn done,
+                         bool force = false) {
+  auto job = std::make_shared<CheckJob>();
+  job->camera_id = camera_id;
+  job->rtsp_url = rtsp_url;
+  job->opts = opts;
+  job->capture_opts = opts;
+  job->done = std::move(done);
+  run_stage(Stage::kCapture, job, capture_stage, force);
+}
+
+// 同一摄像头（camera_id+地址）的并发请求合并：首个请求执行截图和校验，
+// 截止时间不早于它的后到请求等待并共享其结果，避免重复拉流和重复调用
+// AI服务；截止时间更早的请求等不起，自行截图校验。
+// force 时不受截图阶段队列上限约束（由不能阻塞的线程发起时使用）
+static void coalesced_check(uint64_t camera_id, const std::string &rtsp_url,
+                            const CheckOptions &opts, CheckDoneFn done,
+                            bool force) {
+  if (rtsp_url.empty()) {
+    done(json{{"code", 1}, {"msg", "参数缺失"}});
+    return;
+  }
+  auto key = std::make_pair(camera_id, rtsp_url);
+  {
+    std::lock_guard<std::mutex> lock(g_inflight_check_mutex);
+    auto it = g_inflight_checks.find(key);
+    if (it != g_inflight_checks.end()) {
+      // 必须实时截图的请求不能共享可能取自缓存或会话的结果
+      if (it->second.deadline <= opts.deadline &&
+          (it->second.force_live || !opts.force_live)) {
+        ++g_coalesced_checks;
+        it->second.waiters.emplace_back(opts, std::move(done));
+        return;
       }
-      resp = {{"code", 0},
-              {"msg", "自动巡检完成"},
-              {"results", results},
-              {"task_id", task.task_id}};
-      {
-        std::lock_guard<std::mutex> lock(g_result_mutex);
-        g_inspect_results[task.task_id] = resp;
-        g_inspect_time[task.task_id] = std::chrono::steady_clock::now();
+    } else {
+      InflightCheck &check = g_inflight_checks[key];
+      check.deadline = opts.deadline;
+      check.force_live = opts.force_live;
+      check.waiters.emplace_back(opts, std::move(done));
+      done = nullptr;
+    }
+  }
+  if (done) {
+    check_camera(camera_id, rtsp_url, opts, std::move(done), force);
+    return;
+  }
+  check_camera(camera_id, rtsp_url, opts, [key](json resp) {
+    std::vector<std::pair<CheckOptions, CheckDoneFn>> waiters;
+    {
+      std::lock_guard<std::mutex> lock(g_inflight_check_mutex);
+      auto it = g_inflight_checks.find(key);
+      waiters.swap(it->second.waiters);
+      g_inflight_checks.erase(it);
+    }
+    bool timed_out = resp.contains("code") && resp["code"] == 408;
+    for (auto &[opts, done] : waiters) {
+      // 首个请求的截止时间更早而超时，本请求仍有时间则自行重做
+      if (timed_out && Clock::now() < opts.deadline) {
+        check_camera(key.first, key.second, opts, std::move(done), true);
+      } else {
+        done(resp);
       }
     }
-  }).detach();
+  }, force);
+}
+
+void capture_and_check_async(uint64_t camera_id, const std::string &rtsp_url,
+                             const CheckOptions &opts,
+                             std::function<void(json)> done) {
+  coalesced_check(camera_id, rtsp_url, opts, std::move(done), false);
+}
+
+// AI未检测到目标（200220），重新截图校验可能得到结论
+static bool retryable_result(const json &result) {
+  return result.contains("code") && result["code"] == 200220;
+}
+
+// 同步接口重试的定时器，首次使用时创建
+static DelayQueue &retry_queue() {
+  static DelayQueue queue;
+  return queue;
+}
+
+// 带自动重试的截图校验：结果可重试时按指数退避放入延迟队列，到点后实时
+// 重新截图校验，等待期间不占用流水线线程；次数用尽或退避后剩余时间已
+// 不够再处理一次（不足平均耗时的 inspect_drop_ratio 倍）时返回最近一次
+// 结果。策略与异步任务相同，见 inspect_retry_*
+static void check_with_retry(uint64_t camera_id, const std::string &rtsp_url,
+                             const CheckOptions &opts, int attempt,
+                             CheckDoneFn done) {
+  auto start = Clock::now();
+  auto on_done = [camera_id, rtsp_url, opts, attempt, start,
+                  done = std::move(done)](json resp) mutable {
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       Clock::now() - start)
+                       .count();
+    int64_t avg = g_sync_service_ms.load();
+    g_sync_service_ms = avg == 0 ? elapsed : (avg * 4 + elapsed) / 5;
+    if (attempt > 0) resp["attempts"] = attempt + 1;
+    if (!retryable_result(resp)) {
+      if (attempt > 0) ++g_sync_recovered;
+      done(std::move(resp));
+      return;
+    }
+    const auto &conf = get_config();
+    int max_attempts = conf.value("inspect_retry_max_attempts", 2);
+    int64_t backoff = std::min<int64_t>(
+        static_cast<int64_t>(conf.value("inspect_retry_backoff_ms", 1000))
+            << std::min(attempt, 16),
+        conf.value("inspect_retry_backoff_max_ms", 8000));
+    auto ready_at = Clock::now() + std::chrono::milliseconds(backoff);
+    auto min_budget = std::chrono::milliseconds(static_cast<int64_t>(
+        g_sync_service_ms.load() * conf.value("inspect_drop_ratio", 0.5)));
+    bool in_time = opts.deadline == Clock::time_point::max() ||
+                   opts.deadline - ready_at >= min_budget;
+    if (attempt >= max_attempts || !in_time) {
+      if (max_attempts > 0) ++g_sync_exhausted;
+      done(std::move(resp));
+      return;
+    }
+    ++g_sync_retried;
+    retry_queue().post(
+        ready_at, [camera_id, rtsp_url, opts, attempt, resp = std::move(resp),
+                   done = std::move(done)](bool fired) mutable {
+          if (!fired) {
+            done(std::move(resp));
+            return;
+          }
+          // 重试必须实时截图，不能再取刚校验过的缓存帧或会话帧
+          check_with_retry(camera_id, rtsp_url, live_recapture_options(opts),
+                           attempt + 1, std::move(done));
+        });
+  };
+  // 重试由定时线程发起，不能阻塞在截图阶段队列上
+  coalesced_check(camera_id, rtsp_url, opts, std::move(on_done), attempt > 0);
+}
+
+json capture_and_check(uint64_t camera_id, const std::string &rtsp_url,
+                       const CheckOptions &opts) {
+  auto promise = std::make_shared<std::promise<json>>();
+  auto result = promise->get_future();
+  check_with_retry(camera_id, rtsp_url, opts, 0, [promise](json resp) {
+    promise->set_value(std::move(resp));
+  });
+  return result.get();
+}
+
+// 保存异步任务结果，结果按请求中的摄像头顺序排列
+static void save_task_result(const std::string &task_id,
+                             std::vector<json> results) {
+  json resp = {{"code", 0},
+               {"msg", "自动巡检完成"},
+               {"results", std::move(results)},
+               {"task_id", task_id}};
+  std::lock_guard<std::mutex> lock(g_result_mutex);
+  g_inspect_results[task_id] = std::move(resp);
+  g_inspect_time[task_id] = std::chrono::steady_clock::now();
+}
+
+// 异步巡检执行器（EDF调度），按在途上限把摄像头送入巡检流水线
+static std::unique_ptr<InspectExecutor> g_executor;
+static std::mutex g_executor_mutex;
+
+// 启动异步巡检执行器
+void start_inspect_task_worker() {
+  std::lock_guard<std::mutex> lock(g_executor_mutex);
+  if (g_executor) return;
+  const auto &conf = get_config();
+  InspectExecutor::Options opts;
+  // 流水线中同时处理的摄像头数，默认足够让截图与AI校验阶段同时满载
+  opts.max_inflight =
+      conf.value("inspect_max_inflight",
+                 pipeline_stage(Stage::kCapture).concurrency() +
+                     pipeline_stage(Stage::kVerify).concurrency());
+  opts.task_concurrency =
+      conf.value("inspect_task_concurrency", static_cast<size_t>(8));
+  opts.drop_ratio = conf.value("inspect_drop_ratio", 0.5);
+  opts.max_queued_cameras =
+      conf.value("inspect_max_queued_cameras", static_cast<size_t>(2000));
+  // AI未检测到目标（200220）时在截止时间内自动重新截图校验
+  opts.retry_max_attempts = conf.value("inspect_retry_max_attempts", 2);
+  opts.retry_backoff_ms = conf.value("inspect_retry_backoff_ms", 1000);
+  opts.retry_backoff_max_ms = conf.value("inspect_retry_backoff_max_ms", 8000);
+  opts.retryable = retryable_result;
+  g_executor = std::make_unique<InspectExecutor>(
+      opts, capture_and_check_async, save_task_result);
+  g_executor->start();
 }
 
 void stop_inspect_task_worker() {
-  g_task_thread_exit = true;
-  g_task_cv.notify_all();
+  std::lock_guard<std::mutex> lock(g_executor_mutex);
+  if (g_executor) g_executor->stop();
+}
+
+// 后台刷新某摄像头的结论：作为普通巡检任务提交给执行器，结果由
+// capture_and_check 写回结论表，完成后清除刷新标记
+static void refresh_verdict(uint64_t camera_id, const std::string &rtsp_url) {
+  auto clear = [camera_id](const std::string &, std::vector<json>) {
+    std::lock_guard<std::mutex> lock(g_verdict_mutex);
+    auto it = g_verdicts.find(camera_id);
+    if (it != g_verdicts.end()) it->second.refreshing = false;
+  };
+  int timeout_sec = get_config().value("verdict_refresh_timeout_sec", 30);
+  InspectExecutor::QueueInfo info;
+  info.accepted = false;
+  {
+    std::lock_guard<std::mutex> lock(g_executor_mutex);
+    if (g_executor) {
+      info = g_executor->submit(generate_uuid(),
+                                {InspectCamera{camera_id, rtsp_url, 0}},
+                                timeout_sec, clear);
+    }
+  }
+  if (info.accepted) {
+    ++g_verdict_refreshes;
+  } else {
+    clear("", {});
+  }
 }
 
-std::string auto_inspect_async(
-    const std::vector<std::pair<uint64_t, std::string>> &cameras,
-    int timeout_sec, json &result) {
+json get_camera_health(uint64_t camera_id) {
+  CameraHealth &health = camera_health_registry();
+  if (camera_id != 0) return health.get(camera_id);
+  json resp = health.stats();
+  resp["code"] = 0;
+  resp["msg"] = "";
+  return resp;
+}
+
+json get_last_verdict(uint64_t camera_id) {
+  auto refresh_after = std::chrono::milliseconds(
+      get_config().value("verdict_refresh_after_ms", 60000));
+  json resp;
+  std::string refresh_url;
+  {
+    std::lock_guard<std::mutex> lock(g_verdict_mutex);
+    auto it = g_verdicts.find(camera_id);
+    if (it == g_verdicts.end()) {
+      ++g_verdict_misses;
+      return json{{"code", 404},
+                  {"msg", "该摄像头暂无校验结论"},
+                  {"camera_id", camera_id}};
+    }
+    ++g_verdict_hits;
+    VerdictEntry &e = it->second;
+    auto age = Clock::now() - e.checked_at;
+    bool stale = age > refresh_after;
+    if (stale && !e.refreshing) {
+      e.refreshing = true;
+      refresh_url = e.rtsp_url;
+    }
+    resp = {{"code", 0},
+            {"msg", ""},
+            {"camera_id", camera_id},
+            {"result", e.result},
+            {"age_ms",
+             std::chrono::duration_cast<std::chrono::milliseconds>(age)
+                 .count()},
+            {"stale", stale},
+            {"refreshing", e.refreshing}};
+  }
+  // 在锁外提交刷新，先返回旧结论
+  if (!refresh_url.empty()) refresh_verdict(camera_id, refresh_url);
+  return resp;
+}
+
+// 按排队情况给出重试建议（秒），至少1秒
+static int retry_after_sec(int64_t projected_wait_ms) {
+  return static_cast<int>(
+      std::max<int64_t>(1, (projected_wait_ms + 999) / 1000));
+}
+
+std::string auto_inspect_async(const std::vector<InspectCamera> &cameras,
+                               int timeout_sec, json &result) {
   std::string task_id = generate_uuid();
-  // 任务入队
+  InspectExecutor::QueueInfo info;
+  // 在途图片数据超出上限时快速拒绝，避免上游风暴时内存持续上涨
+  if (g_inflight_image_bytes >= get_max_inflight_image_bytes()) {
+    ++g_rejected_tasks;
+    {
+      std::lock_guard<std::mutex> lock(g_executor_mutex);
+      if (g_executor) info = g_executor->queue_info();
+    }
+    result = {{"code", 429},
+              {"msg", "在途图片数据已达上限，请稍后重试"},
+              {"retry_after_sec", retry_after_sec(info.projected_wait_ms)}};
+    return "";
+  }
+  // 任务入队，超时从提交时刻起算
   {
-    std::lock_guard<std::mutex> lock(g_task_mutex);
-    g_task_queue.push(InspectTask{task_id, cameras, timeout_sec});
+    std::lock_guard<std::mutex> lock(g_executor_mutex);
+    if (!g_executor) {
+      result = {{"code", 500}, {"msg", "巡检执行器未启动"}};
+      return "";
+    }
+    info = g_executor->submit(task_id, cameras, timeout_sec);
+  }
+  if (!info.accepted) {
+    result = {{"code", 429},
+              {"msg", "巡检队列已满，请稍后重试"},
+              {"queue_depth", info.queue_depth},
+              {"retry_after_sec", retry_after_sec(info.projected_wait_ms)}};
+    return "";
   }
-  g_task_cv.notify_one();
-  // 立即返回task_id
-  result = {{"code", 0}, {"msg", "任务已提交"}, {"task_id", task_id}};
+  // 立即返回task_id，附带排队深度与预计等待时间供调用方调整节奏
+  result = {{"code", 0},
+            {"msg", "任务已提交"},
+            {"task_id", task_id},
+            {"queue_depth", info.queue_depth},
+            {"projected_wait_ms", info.projected_wait_ms}};
   return task_id;
 }
 
@@ -241,3 +1343,98 @@ void start_inspect_result_cleaner() {
     }
   }).detach();
 }
+
+json get_inspect_stats() {
+  json stats = {{"code", 0}, {"msg", ""}};
+  StreamSessionPool *pool = get_session_pool();
+  stats["session_pool"] = pool ? pool->stats() : json{{"enabled", false}};
+  stats["ai_client"] = get_ai_backend().stats();
+  stats["ai_guard"] = ai_guard().stats();
+  stats["camera_health"] = camera_health_registry().stats();
+  FrameCache *cache = get_frame_cache();
+  stats["frame_cache"] = cache ? cache->stats() : json{{"enabled", false}};
+  {
+    std::lock_guard<std::mutex> lock(g_executor_mutex);
+    if (g_executor) stats["executor"] = g_executor->stats();
+  }
+  stats["admission"] = {
+      {"inflight_image_bytes", g_inflight_image_bytes.load()},
+      {"max_inflight_image_bytes", get_max_inflight_image_bytes()},
+      {"rejected_tasks", g_rejected_tasks.load()}};
+  {
+    std::lock_guard<std::mutex> lock(g_inflight_check_mutex);
+    stats["coalescing"] = {{"inflight_checks", g_inflight_checks.size()},
+                           {"coalesced_checks", g_coalesced_checks.load()}};
+  }
+  json sync_retry = retry_queue().stats();
+  sync_retry["retried"] = g_sync_retried.load();
+  sync_retry["recovered"] = g_sync_recovered.load();
+  sync_retry["exhausted"] = g_sync_exhausted.load();
+  stats["sync_retry"] = std::move(sync_retry);
+  stats["upstream"] = upstream_limiter().stats();
+  stats["pipeline"] = {
+      {"capture", pipeline_stage(Stage::kCapture).stats()},
+      {"preprocess", pipeline_stage(Stage::kPreprocess).stats()},
+      {"verify", pipeline_stage(Stage::kVerify).stats()},
+      {"result", pipeline_stage(Stage::kResult).stats()}};
+  uint64_t checked = g_dedupe_checked.load();
+  uint64_t reused = g_dedupe_reused.load();
+  stats["dedupe"] = {
+      {"hamming_threshold",
+       get_config().value("dedupe_hamming_threshold", 0)},
+      {"checked", checked},
+      {"reused", reused},
+      {"hit_rate", checked ? static_cast<double>(reused) / checked : 0.0}};
+  EncodeCounters enc = encode_counters();
+  double pixel_ratio =
+      enc.source_pixels
+          ? static_cast<double>(enc.output_pixels) / enc.source_pixels
+          : 1.0;
+  uint64_t uploads = g_upload_images.load();
+  stats["preprocess"] = {
+      {"ai_max_width", get_config().value("ai_max_width", 0)},
+      {"ai_max_height", get_config().value("ai_max_height", 0)},
+      {"roi_cameras", get_camera_rois().size()},
+      {"encoded_frames", enc.frames},
+      {"source_pixels", enc.source_pixels},
+      {"output_pixels", enc.output_pixels},
+      {"pixel_ratio", pixel_ratio},
+      {"uploaded_images", uploads},
+      {"uploaded_bytes", g_upload_bytes.load()},
+      {"avg_upload_kb",
+       uploads ? g_upload_bytes.load() / 1024.0 / uploads : 0.0}};
+  uint64_t bursts = g_burst_captures.load();
+  {
+    std::lock_guard<std::mutex> lock(g_stream_mutex);
+    stats["stream_info"] = {
+        {"enabled", get_config().value("capture_learn_stream_info", true)},
+        {"learned", g_streams.size()},
+        {"fast_opens", g_stream_fast_opens.load()},
+        {"full_probes", g_stream_full_probes.load()},
+        {"mismatches", g_stream_mismatches.load()}};
+  }
+  stats["burst"] = {
+      {"burst_frames", get_config().value("capture_burst_frames", 1)},
+      {"burst_ms", get_config().value("capture_burst_ms", 0)},
+      {"captures", bursts},
+      {"avg_frames",
+       bursts ? static_cast<double>(g_burst_frames.load()) / bursts : 0.0},
+      {"picked_later_frame", g_burst_improved.load()}};
+  stats["quality"] = {
+      {"enabled", get_config().value("quality_check_enable", false)},
+      {"checked", g_quality_checked.load()},
+      {"recaptured", g_quality_recaptured.load()},
+      {"rejected_dark", g_quality_dark.load()},
+      {"rejected_bright", g_quality_bright.load()},
+      {"rejected_flat", g_quality_flat.load()},
+      {"rejected_blurred", g_quality_blurred.load()},
+      {"analysis_failures", g_analysis_failures.load()}};
+  {
+    std::lock_guard<std::mutex> lock(g_verdict_mutex);
+    stats["verdict_cache"] = {{"entries", g_verdicts.size()},
+                              {"hits", g_verdict_hits.load()},
+                              {"misses", g_verdict_misses.load()},
+                              {"refreshes", g_verdict_refreshes.load()}};
+  }
+  return stats;
+}
@@ -1,23 +1,62 @@
 #pragma once
+#include <chrono>
+#include <functional>
 #include <string>
 #include <vector>
 
 #include "3rdparty/include/json/include/nlohmann/json.hpp"
 
+// 单次截图校验的附加参数
+struct CheckOptions {
+  // 截止时间：截图与AI校验须在此之前完成，否则返回408；默认不限
+  std::chrono::steady_clock::time_point deadline =
+      std::chrono::steady_clock::time_point::max();
+  // 可接受的缓存截图最大时长（毫秒），0表示不取截图缓存。开启常驻会话池
+  // 时仍可能取会话中的最新帧（不超过 session_max_frame_age_ms），必须实时
+  // 截图时用 force_live
+  int max_age_ms = 0;
+  // 必须实时截图：既不取截图缓存，也不取常驻会话中的最新帧。
+  // 质量不合格重截与自动重试时使用
+  bool force_live = false;
+};
+
+// 批量巡检中的单个摄像头
+struct InspectCamera {
+  uint64_t camera_id = 0;
+  std::string rtsp_url;
+  int max_age_ms = 0;  // 同 CheckOptions::max_age_ms
+};
+
 // 单摄像头截图+AI校验
 nlohmann::json capture_and_check(uint64_t camera_id,
-                                 const std::string &rtsp_url);
+                                 const std::string &rtsp_url,
+                                 const CheckOptions &opts = CheckOptions());
+
+// 同上，经巡检流水线异步执行，结果回调 done（在流水线线程中调用）
+void capture_and_check_async(uint64_t camera_id, const std::string &rtsp_url,
+                             const CheckOptions &opts,
+                             std::function<void(nlohmann::json)> done);
 
 // 支持多任务并发巡检
-std::string auto_inspect_async(
-    const std::vector<std::pair<uint64_t, std::string>> &cameras,
-    int timeout_sec, nlohmann::json &result);
+std::string auto_inspect_async(const std::vector<InspectCamera> &cameras,
+                               int timeout_sec, nlohmann::json &result);
 nlohmann::json get_inspect_result(const std::string &task_id);
 
 // 保存和查询巡检结果
 void save_inspect_result(const nlohmann::json &result);
 nlohmann::json get_last_inspect_result();
 
+// 查询摄像头最近一次校验结论，立即返回；结论超过 verdict_refresh_after_ms
+// 时在后台异步重新截图校验，下次查询即可拿到新结论
+nlohmann::json get_last_verdict(uint64_t camera_id);
+
+// 查询摄像头健康状况：连续失败次数、退避剩余时间、截图耗时分位数与
+// 自适应截图超时；camera_id 为0时返回汇总（退避中的摄像头列表等）
+nlohmann::json get_camera_health(uint64_t camera_id);
+
+// 巡检运行状态（常驻会话池等）
+nlohmann::json get_inspect_stats();
+
 // 启动定期清理线程
 void start_inspect_result_cleaner();
 
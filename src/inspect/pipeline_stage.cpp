@@ -0,0 +1,108 @@
+#include "pipeline_stage.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+PipelineStage::PipelineStage(const Options &opts) : opts_(opts) {
+  if (opts_.concurrency == 0) opts_.concurrency = 1;
+  if (opts_.max_queue == 0) opts_.max_queue = 1;
+  window_start_ = Clock::now();
+  for (size_t i = 0; i < opts_.concurrency; ++i) {
+    workers_.emplace_back([this]() { worker_loop(); });
+  }
+  spdlog::info("巡检流水线阶段[{}]启动，并发{}，队列上限{}", opts_.name,
+               opts_.concurrency, opts_.max_queue);
+}
+
+PipelineStage::~PipelineStage() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exit_ = true;
+  }
+  cv_.notify_all();
+  space_cv_.notify_all();
+  for (auto &t : workers_) {
+    if (t.joinable()) t.join();
+  }
+}
+
+void PipelineStage::submit(std::function<void()> fn, bool force) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!force && queue_.size() >= opts_.max_queue) {
+      ++blocked_submits_;
+      space_cv_.wait(lock, [this] {
+        return exit_ || queue_.size() < opts_.max_queue;
+      });
+    }
+    if (exit_) return;
+    queue_.push_back(Item{std::move(fn), Clock::now()});
+    peak_queue_ = std::max(peak_queue_, queue_.size());
+  }
+  cv_.notify_one();
+}
+
+void PipelineStage::worker_loop() {
+  while (true) {
+    Item item;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return exit_ || !queue_.empty(); });
+      if (exit_) break;
+      item = std::move(queue_.front());
+      queue_.pop_front();
+      ++busy_;
+    }
+    space_cv_.notify_one();
+    auto start = Clock::now();
+    try {
+      item.fn();
+    } catch (const std::exception &e) {
+      spdlog::error("巡检流水线阶段[{}]任务异常: {}", opts_.name, e.what());
+    }
+    auto end = Clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    --busy_;
+    ++processed_;
+    auto us = [](Clock::duration d) {
+      return static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+    };
+    wait_us_total_ += us(start - item.queued_at);
+    run_us_total_ += us(end - start);
+    run_us_window_ += us(end - std::max(start, window_start_));
+  }
+}
+
+json PipelineStage::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto now = Clock::now();
+  double window_us = static_cast<double>(
+      std::chrono::duration_cast<std::chrono::microseconds>(now -
+                                                            window_start_)
+          .count());
+  // 利用率：窗口内已完成任务的执行时长占全部线程时间的比例
+  double utilization =
+      window_us > 0 ? run_us_window_ / (window_us * opts_.concurrency) : 0.0;
+  window_start_ = now;
+  run_us_window_ = 0;
+  return json{
+      {"concurrency", opts_.concurrency},
+      {"busy", busy_},
+      {"queue_depth", queue_.size()},
+      {"max_queue", opts_.max_queue},
+      {"peak_queue", peak_queue_},
+      {"processed", processed_},
+      {"blocked_submits", blocked_submits_},
+      {"avg_wait_ms",
+       processed_ ? static_cast<double>(wait_us_total_) / processed_ / 1000.0
+                  : 0.0},
+      {"avg_run_ms",
+       processed_ ? static_cast<double>(run_us_total_) / processed_ / 1000.0
+                  : 0.0},
+      {"utilization", std::min(1.0, utilization)}};
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 巡检流水线的一个阶段：固定数量的工作线程从有界队列中取任务执行。
+// 截图、预处理、AI校验、结果汇总各用一个阶段，互不占用线程，摄像头 k+1
+// 的截图可以和摄像头 k 的AI校验同时进行，各阶段并发可分别按耗时调整。
+class PipelineStage {
+ public:
+  struct Options {
+    std::string name;
+    size_t concurrency = 4;  // 工作线程数
+    size_t max_queue = 256;  // 队列上限，满时 submit 阻塞等待（反压）
+  };
+
+  explicit PipelineStage(const Options &opts);
+  ~PipelineStage();
+  PipelineStage(const PipelineStage &) = delete;
+  PipelineStage &operator=(const PipelineStage &) = delete;
+
+  // 提交一个任务。队列已满时阻塞到有空位；force 为 true 时不受队列上限
+  // 约束，供下游阶段回送任务时使用，避免阶段之间互相等待而死锁
+  void submit(std::function<void()> fn, bool force = false);
+
+  size_t concurrency() const { return opts_.concurrency; }
+
+  // 队列深度、忙碌线程数、排队与执行耗时，以及自上次查询以来的利用率
+  nlohmann::json stats();
+
+ private:
+  struct Item {
+    std::function<void()> fn;
+    std::chrono::steady_clock::time_point queued_at;
+  };
+
+  void worker_loop();
+
+  Options opts_;
+  std::mutex mutex_;
+  std::condition_variable cv_;        // 有新任务
+  std::condition_variable space_cv_;  // 队列有空位
+  std::deque<Item> queue_;
+  std::vector<std::thread> workers_;
+  bool exit_ = false;
+  size_t busy_ = 0;
+  size_t peak_queue_ = 0;
+  uint64_t processed_ = 0;
+  uint64_t blocked_submits_ = 0;  // 因队列满而等待的提交次数
+  uint64_t wait_us_total_ = 0;    // 累计排队时长
+  uint64_t run_us_total_ = 0;     // 累计执行时长
+  uint64_t run_us_window_ = 0;    // 上次查询以来的执行时长
+  std::chrono::steady_clock::time_point window_start_;
+};
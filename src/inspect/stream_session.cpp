@@ -0,0 +1,301 @@
+#include "stream_session.h"
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+}
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+#include "frame_grabber.h"
+
+using Clock = std::chrono::steady_clock;
+
+// 单个会话的内存估算：解复用/网络缓冲的固定开销 + 解码器参考帧
+// （按4帧YUV420估算）+ 已编码的JPEG
+static constexpr size_t kSessionBaseBytes = 512 * 1024;
+static constexpr size_t kDecoderFrames = 4;
+static constexpr int kDefaultWidth = 1920;
+static constexpr int kDefaultHeight = 1080;
+
+struct StreamSessionPool::Session {
+  uint64_t camera_id = 0;
+  std::string url;
+  std::thread worker;
+  std::atomic<bool> stop{false};
+  std::atomic<bool> connected{false};
+  std::atomic<Clock::rep> last_access{0};
+  std::mutex mutex;
+  std::condition_variable cv;
+  AVFrame *latest = nullptr;  // 最新关键帧
+  Clock::time_point latest_at;
+  uint64_t seq = 0;  // 最新帧序号，0表示尚无帧
+  std::vector<uint8_t> jpeg;  // 最新帧的JPEG缓存
+  uint64_t jpeg_seq = 0;
+  uint64_t rejected_seq = 0;  // 被作废（未通过质量检查）的帧序号
+  std::atomic<int> width{0};
+  std::atomic<int> height{0};
+  std::atomic<size_t> jpeg_bytes{0};
+
+  Session() : latest(av_frame_alloc()) {}
+  ~Session() { av_frame_free(&latest); }
+
+  size_t memory_estimate() const {
+    size_t w = width ? width.load() : kDefaultWidth;
+    size_t h = height ? height.load() : kDefaultHeight;
+    return kSessionBaseBytes + w * h * 3 / 2 * kDecoderFrames + jpeg_bytes;
+  }
+};
+
+StreamSessionPool::StreamSessionPool(const Options &opts) : opts_(opts) {
+  reaper_ = std::thread([this]() { reap_loop(); });
+}
+
+StreamSessionPool::~StreamSessionPool() {
+  exit_ = true;
+  reap_cv_.notify_all();
+  if (reaper_.joinable()) reaper_.join();
+  std::unordered_map<uint64_t, std::shared_ptr<Session>> sessions;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sessions.swap(sessions_);
+  }
+  for (auto &kv : sessions) {
+    kv.second->stop = true;
+    kv.second->cv.notify_all();
+  }
+  for (auto &kv : sessions) {
+    if (kv.second->worker.joinable()) kv.second->worker.join();
+  }
+}
+
+size_t StreamSessionPool::memory_estimate_locked() const {
+  size_t total = 0;
+  for (const auto &kv : sessions_) total += kv.second->memory_estimate();
+  return total;
+}
+
+bool StreamSessionPool::can_admit_locked() const {
+  if (sessions_.size() >= opts_.max_sessions) return false;
+  size_t need = kSessionBaseBytes +
+                static_cast<size_t>(kDefaultWidth) * kDefaultHeight * 3 / 2 *
+                    kDecoderFrames;
+  return memory_estimate_locked() + need <= opts_.max_memory_bytes;
+}
+
+std::shared_ptr<StreamSessionPool::Session> StreamSessionPool::touch(
+    uint64_t camera_id, const std::string &url) {
+  auto now = Clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = sessions_.find(camera_id);
+  if (it != sessions_.end() && it->second->url == url) {
+    it->second->last_access = now.time_since_epoch().count();
+    return it->second;
+  }
+  auto &rec = hits_[camera_id];
+  if (rec.count == 0 ||
+      now - rec.window_start > std::chrono::seconds(opts_.promote_window_sec)) {
+    rec.count = 0;
+    rec.window_start = now;
+  }
+  if (++rec.count < opts_.promote_hits) return nullptr;
+  if (it != sessions_.end()) {
+    // 同一camera_id换了地址：旧会话交给回收线程关闭
+    it->second->stop = true;
+    it->second->cv.notify_all();
+    return nullptr;
+  }
+  if (!can_admit_locked()) {
+    ++rejected_;
+    return nullptr;
+  }
+  hits_.erase(camera_id);
+  auto s = std::make_shared<Session>();
+  s->camera_id = camera_id;
+  s->url = url;
+  s->last_access = now.time_since_epoch().count();
+  s->worker = std::thread([this, s]() { run_session(s); });
+  sessions_[camera_id] = s;
+  spdlog::info("摄像头{}建立常驻拉流会话，当前会话数{}", camera_id,
+               sessions_.size());
+  return s;
+}
+
+bool StreamSessionPool::get_latest_jpeg(uint64_t camera_id,
+                                        const std::string &url,
+                                        const FrameTransform &transform,
+                                        std::vector<uint8_t> &jpeg,
+                                        uint64_t *frame_seq) {
+  auto s = touch(camera_id, url);
+  if (!s) {
+    ++frame_misses_;
+    return false;
+  }
+  AVFrame *ref = av_frame_alloc();
+  uint64_t seq = 0;
+  {
+    std::lock_guard<std::mutex> lock(s->mutex);
+    bool fresh = s->seq != 0 && s->seq != s->rejected_seq &&
+                 Clock::now() - s->latest_at <=
+                     std::chrono::milliseconds(opts_.max_frame_age_ms);
+    if (fresh && s->jpeg_seq == s->seq) {
+      jpeg = s->jpeg;
+      if (frame_seq) *frame_seq = s->seq;
+      av_frame_free(&ref);
+      ++frame_hits_;
+      return true;
+    }
+    if (!fresh || av_frame_ref(ref, s->latest) < 0) {
+      av_frame_free(&ref);
+      ++frame_misses_;
+      return false;
+    }
+    seq = s->seq;
+  }
+  // 编码放在锁外，避免阻塞后台解码线程更新最新帧
+  std::string err;
+  bool ok = encode_jpeg(ref, opts_.jpeg_quality, transform, jpeg, err);
+  av_frame_free(&ref);
+  if (!ok) {
+    spdlog::warn("摄像头{}最新帧编码失败: {}", camera_id, err);
+    ++frame_misses_;
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(s->mutex);
+    if (s->seq == seq && s->rejected_seq != seq) {
+      s->jpeg = jpeg;
+      s->jpeg_seq = seq;
+      s->jpeg_bytes = jpeg.size();
+    }
+  }
+  if (frame_seq) *frame_seq = seq;
+  ++frame_hits_;
+  return true;
+}
+
+void StreamSessionPool::reject_frame(uint64_t camera_id, uint64_t frame_seq) {
+  std::shared_ptr<Session> s;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sessions_.find(camera_id);
+    if (it == sessions_.end()) return;
+    s = it->second;
+  }
+  std::lock_guard<std::mutex> lock(s->mutex);
+  if (frame_seq == 0 || s->seq != frame_seq) return;
+  s->rejected_seq = frame_seq;
+  if (s->jpeg_seq == frame_seq) {
+    s->jpeg = std::vector<uint8_t>();
+    s->jpeg_seq = 0;
+    s->jpeg_bytes = 0;
+  }
+  ++frames_rejected_;
+}
+
+void StreamSessionPool::run_session(std::shared_ptr<Session> s) {
+  FrameGrabber::Options gopts;
+  gopts.timeout_ms = opts_.open_timeout_ms;
+  gopts.low_delay = true;
+  FrameGrabber grabber(gopts);
+  grabber.set_abort_flag(&s->stop);
+  AVFrame *frame = av_frame_alloc();
+  int failures = 0;
+  while (!s->stop) {
+    std::string err;
+    if (!grabber.is_open()) {
+      if (!grabber.open(s->url, err)) {
+        s->connected = false;
+        // 连续失败时指数退避重连，避免对离线摄像头反复握手
+        int backoff = std::min(1 << std::min(failures, 5), 30);
+        ++failures;
+        spdlog::warn("摄像头{}常驻会话连接失败({}s后重试): {}", s->camera_id,
+                     backoff, err);
+        std::unique_lock<std::mutex> lock(s->mutex);
+        s->cv.wait_for(lock, std::chrono::seconds(backoff),
+                       [&s] { return s->stop.load(); });
+        continue;
+      }
+      s->connected = true;
+      failures = 0;
+    }
+    grabber.reset_deadline(opts_.read_timeout_ms);
+    if (!grabber.decode_frame(frame, true, err)) {
+      if (!s->stop) {
+        spdlog::warn("摄像头{}常驻会话读取中断: {}", s->camera_id, err);
+      }
+      grabber.close();
+      s->connected = false;
+      continue;
+    }
+    s->width = frame->width;
+    s->height = frame->height;
+    std::lock_guard<std::mutex> lock(s->mutex);
+    av_frame_unref(s->latest);
+    av_frame_move_ref(s->latest, frame);
+    s->latest_at = Clock::now();
+    ++s->seq;
+  }
+  grabber.close();
+  s->connected = false;
+  av_frame_free(&frame);
+}
+
+void StreamSessionPool::reap_loop() {
+  while (!exit_) {
+    std::vector<std::shared_ptr<Session>> expired;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      reap_cv_.wait_for(lock, std::chrono::seconds(1),
+                        [this] { return exit_.load(); });
+      if (exit_) break;
+      auto now = Clock::now();
+      auto ttl = std::chrono::seconds(opts_.idle_ttl_sec);
+      for (auto it = sessions_.begin(); it != sessions_.end();) {
+        auto &s = it->second;
+        Clock::time_point last{Clock::duration(s->last_access.load())};
+        if (s->stop || now - last > ttl) {
+          s->stop = true;
+          s->cv.notify_all();
+          expired.push_back(s);
+          it = sessions_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      for (auto it = hits_.begin(); it != hits_.end();) {
+        if (now - it->second.window_start >
+            std::chrono::seconds(opts_.promote_window_sec)) {
+          it = hits_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+    // 在锁外等待会话线程退出（最多一次读超时）
+    for (auto &s : expired) {
+      if (s->worker.joinable()) s->worker.join();
+      spdlog::info("摄像头{}常驻拉流会话已关闭", s->camera_id);
+    }
+  }
+}
+
+nlohmann::json StreamSessionPool::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t connected = 0;
+  for (const auto &kv : sessions_) {
+    if (kv.second->connected) ++connected;
+  }
+  return nlohmann::json{
+      {"sessions", sessions_.size()},
+      {"sockets", connected},
+      {"memory_bytes", memory_estimate_locked()},
+      {"max_sessions", opts_.max_sessions},
+      {"max_memory_bytes", opts_.max_memory_bytes},
+      {"frame_hits", frame_hits_.load()},
+      {"frame_misses", frame_misses_.load()},
+      {"rejected_sessions", rejected_.load()},
+      {"rejected_frames", frames_rejected_.load()},
+  };
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "frame_grabber.h"
+
+// 常驻拉流会话池：对频繁巡检的摄像头保持 RTSP/HTTP-FLV 长连接，
+// 后台只解码关键帧到"最新帧"槽位，截图时直接取最新帧，省去每次
+// DESCRIBE/SETUP/PLAY 握手和等待关键帧的 1~4 秒。
+class StreamSessionPool {
+ public:
+  struct Options {
+    int idle_ttl_sec = 300;        // 会话空闲超过该时长自动关闭
+    int promote_hits = 2;          // 窗口内被截图次数达到该值才建立常驻会话
+    int promote_window_sec = 600;  // 统计截图次数的时间窗口
+    int max_frame_age_ms = 5000;   // 最新帧超过该时长视为过期，不再使用
+    int open_timeout_ms = 10000;   // 建立连接的超时
+    int read_timeout_ms = 10000;   // 两个关键帧之间的最长等待
+    int jpeg_quality = 2;
+    size_t max_sessions = 200;              // 会话（即socket）数上限
+    size_t max_memory_bytes = 1024ull << 20;  // 会话内存估算上限
+  };
+
+  explicit StreamSessionPool(const Options &opts);
+  ~StreamSessionPool();
+  StreamSessionPool(const StreamSessionPool &) = delete;
+  StreamSessionPool &operator=(const StreamSessionPool &) = delete;
+
+  // 取该摄像头的最新帧 JPEG；无热会话、帧已过期或已被作废时返回 false，
+  // 同时记录一次访问，频繁访问的摄像头会在后台建立常驻会话。
+  // 编码前按 transform 裁剪缩放，同一摄像头每次须传入相同的 transform。
+  // frame_seq 非空时返回该帧序号，供 reject_frame 使用
+  bool get_latest_jpeg(uint64_t camera_id, const std::string &url,
+                       const FrameTransform &transform,
+                       std::vector<uint8_t> &jpeg,
+                       uint64_t *frame_seq = nullptr);
+
+  // 作废序号为 frame_seq 的最新帧（如未通过画面质量检查）：丢弃其JPEG
+  // 缓存，解码出下一帧之前不再返回；最新帧已更新时不做处理
+  void reject_frame(uint64_t camera_id, uint64_t frame_seq);
+
+  // 会话数、socket数、内存估算及其预算、命中统计
+  nlohmann::json stats();
+
+ private:
+  struct Session;
+  struct HitRecord {
+    int count = 0;
+    std::chrono::steady_clock::time_point window_start;
+  };
+
+  std::shared_ptr<Session> touch(uint64_t camera_id, const std::string &url);
+  bool can_admit_locked() const;
+  size_t memory_estimate_locked() const;
+  void run_session(std::shared_ptr<Session> s);
+  void reap_loop();
+
+  Options opts_;
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, std::shared_ptr<Session>> sessions_;
+  std::unordered_map<uint64_t, HitRecord> hits_;
+  std::atomic<bool> exit_{false};
+  std::condition_variable reap_cv_;
+  std::thread reaper_;
+  std::atomic<uint64_t> frame_hits_{0};
+  std::atomic<uint64_t> frame_misses_{0};
+  std::atomic<uint64_t> rejected_{0};
+  std::atomic<uint64_t> frames_rejected_{0};
+};
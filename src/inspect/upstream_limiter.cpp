@@ -0,0 +1,283 @@
+#include "upstream_limiter.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <vector>
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+static bool has_limit(const UpstreamLimiter::Limit &limit) {
+  return limit.max_concurrent > 0 || limit.rate_per_sec > 0;
+}
+
+UpstreamLimiter::UpstreamLimiter(const Options &opts) : opts_(opts) {
+  dispatcher_ = std::thread([this]() { dispatch_loop(); });
+  spdlog::info("截图上游限流启动，单主机并发{}，速率{}/秒，单独配置{}项",
+               opts_.per_host.max_concurrent, opts_.per_host.rate_per_sec,
+               opts_.overrides.size());
+}
+
+UpstreamLimiter::~UpstreamLimiter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exit_ = true;
+  }
+  cv_.notify_all();
+  if (dispatcher_.joinable()) dispatcher_.join();
+}
+
+bool UpstreamLimiter::parse_upstream(const std::string &url, std::string &host,
+                                     int &port) {
+  size_t pos = url.find("://");
+  if (pos == std::string::npos || pos == 0) return false;
+  std::string scheme = url.substr(0, pos);
+  std::transform(scheme.begin(), scheme.end(), scheme.begin(), ::tolower);
+  std::string auth = url.substr(pos + 3);
+  auth = auth.substr(0, auth.find_first_of("/?#"));
+  size_t at = auth.rfind('@');
+  if (at != std::string::npos) auth = auth.substr(at + 1);
+  std::string port_str;
+  if (!auth.empty() && auth[0] == '[') {
+    // IPv6 字面量：[::1]:554
+    size_t close = auth.find(']');
+    if (close == std::string::npos) return false;
+    host = auth.substr(1, close - 1);
+    if (close + 1 < auth.size() && auth[close + 1] == ':') {
+      port_str = auth.substr(close + 2);
+    }
+  } else {
+    size_t colon = auth.rfind(':');
+    host = auth.substr(0, colon);
+    if (colon != std::string::npos) port_str = auth.substr(colon + 1);
+  }
+  if (host.empty()) return false;
+  std::transform(host.begin(), host.end(), host.begin(), ::tolower);
+  if (!port_str.empty() && port_str.size() <= 5 &&
+      std::all_of(port_str.begin(), port_str.end(), ::isdigit)) {
+    port = std::stoi(port_str);
+    return true;
+  }
+  static const std::map<std::string, int> default_ports = {
+      {"rtsp", 554}, {"rtsps", 322}, {"rtmp", 1935},
+      {"http", 80},  {"https", 443}};
+  auto it = default_ports.find(scheme);
+  port = it != default_ports.end() ? it->second : 0;
+  return true;
+}
+
+UpstreamLimiter::Gate *UpstreamLimiter::gate_locked(const std::string &key,
+                                                    const Limit &limit) {
+  auto it = gates_.find(key);
+  if (it == gates_.end()) {
+    Gate gate;
+    gate.limit = limit;
+    gate.tokens = std::max(limit.burst, 1.0);
+    gate.refilled = Clock::now();
+    it = gates_.emplace(key, gate).first;
+  }
+  return &it->second;
+}
+
+void UpstreamLimiter::gates_locked(const std::string &rtsp_url,
+                                   Gate *&host_gate, Gate *&endpoint_gate,
+                                   std::string &host) {
+  host_gate = nullptr;
+  endpoint_gate = nullptr;
+  int port = 0;
+  if (!parse_upstream(rtsp_url, host, port)) return;
+  auto it = opts_.overrides.find(host);
+  const Limit &limit =
+      it != opts_.overrides.end() ? it->second : opts_.per_host;
+  if (has_limit(limit)) host_gate = gate_locked(host, limit);
+  std::string endpoint = host + ":" + std::to_string(port);
+  it = opts_.overrides.find(endpoint);
+  if (it != opts_.overrides.end() && has_limit(it->second)) {
+    endpoint_gate = gate_locked(endpoint, it->second);
+  }
+}
+
+// 按令牌桶补充令牌后判断能否放行；缺令牌时 retry_at 更新为补足一枚的时间
+bool UpstreamLimiter::can_admit_locked(Gate *gate, Clock::time_point now,
+                                       Clock::time_point &retry_at) {
+  if (!gate) return true;
+  const Limit &limit = gate->limit;
+  if (limit.rate_per_sec > 0) {
+    double elapsed =
+        std::chrono::duration<double>(now - gate->refilled).count();
+    gate->tokens =
+        std::min(std::max(limit.burst, 1.0),
+                 gate->tokens + elapsed * limit.rate_per_sec);
+    gate->refilled = now;
+  }
+  if (limit.max_concurrent > 0 && gate->active >= limit.max_concurrent) {
+    return false;
+  }
+  if (limit.rate_per_sec > 0 && gate->tokens < 1.0) {
+    auto wait = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>((1.0 - gate->tokens) /
+                                      limit.rate_per_sec));
+    retry_at = std::min(retry_at, now + wait);
+    return false;
+  }
+  return true;
+}
+
+void UpstreamLimiter::admit_locked(Gate *gate) {
+  if (!gate) return;
+  ++gate->active;
+  gate->peak_active = std::max(gate->peak_active, gate->active);
+  if (gate->limit.rate_per_sec > 0) gate->tokens -= 1.0;
+  ++gate->admitted;
+}
+
+void UpstreamLimiter::acquire(const std::string &rtsp_url,
+                              Clock::time_point deadline, AdmitFn fn) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Gate *host_gate = nullptr;
+    Gate *endpoint_gate = nullptr;
+    std::string host;
+    gates_locked(rtsp_url, host_gate, endpoint_gate, host);
+    bool admit = !host_gate && !endpoint_gate;
+    if (!admit && queues_.count(host) == 0) {
+      // 该主机没有排队中的截图时可直接放行，否则排在它们之后
+      auto now = Clock::now();
+      auto retry_at = Clock::time_point::max();
+      if (can_admit_locked(host_gate, now, retry_at) &&
+          can_admit_locked(endpoint_gate, now, retry_at)) {
+        admit_locked(host_gate);
+        admit_locked(endpoint_gate);
+        admit = true;
+      }
+    }
+    if (!admit) {
+      if (host_gate) ++host_gate->queued;
+      if (endpoint_gate) ++endpoint_gate->queued;
+      queues_[host].push_back(
+          Pending{host_gate, endpoint_gate, deadline, std::move(fn)});
+      cv_.notify_all();
+      return;
+    }
+  }
+  fn(true);
+}
+
+void UpstreamLimiter::release(const std::string &rtsp_url) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Gate *host_gate = nullptr;
+    Gate *endpoint_gate = nullptr;
+    std::string host;
+    gates_locked(rtsp_url, host_gate, endpoint_gate, host);
+    if (!host_gate && !endpoint_gate) return;
+    if (host_gate && host_gate->active > 0) --host_gate->active;
+    if (endpoint_gate && endpoint_gate->active > 0) --endpoint_gate->active;
+  }
+  cv_.notify_all();
+}
+
+void UpstreamLimiter::dispatch_loop() {
+  bool stop = false;
+  while (!stop) {
+    std::vector<AdmitFn> admitted;
+    std::vector<AdmitFn> expired;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (!exit_) {
+        auto now = Clock::now();
+        auto wake = Clock::time_point::max();
+        // 排队到截止时间的截图不再等待
+        for (auto &[host, queue] : queues_) {
+          for (auto it = queue.begin(); it != queue.end();) {
+            if (it->deadline > now) {
+              wake = std::min(wake, it->deadline);
+              ++it;
+              continue;
+            }
+            if (it->host_gate) ++it->host_gate->timed_out;
+            if (it->endpoint_gate) ++it->endpoint_gate->timed_out;
+            expired.push_back(std::move(it->fn));
+            it = queue.erase(it);
+          }
+        }
+        // 按主机轮转，每轮每个主机最多放行一个，直到没有可放行的
+        bool progress = true;
+        while (progress) {
+          progress = false;
+          std::vector<std::string> order;
+          for (auto it = queues_.upper_bound(cursor_); it != queues_.end();
+               ++it) {
+            order.push_back(it->first);
+          }
+          for (auto it = queues_.begin();
+               it != queues_.end() && it->first <= cursor_; ++it) {
+            order.push_back(it->first);
+          }
+          for (const auto &host : order) {
+            auto &queue = queues_[host];
+            for (auto it = queue.begin(); it != queue.end(); ++it) {
+              if (!can_admit_locked(it->host_gate, now, wake)) break;
+              if (!can_admit_locked(it->endpoint_gate, now, wake)) continue;
+              admit_locked(it->host_gate);
+              admit_locked(it->endpoint_gate);
+              admitted.push_back(std::move(it->fn));
+              queue.erase(it);
+              cursor_ = host;
+              progress = true;
+              break;
+            }
+          }
+        }
+        for (auto it = queues_.begin(); it != queues_.end();) {
+          it = it->second.empty() ? queues_.erase(it) : std::next(it);
+        }
+        if (!admitted.empty() || !expired.empty()) break;
+        if (wake == Clock::time_point::max()) {
+          cv_.wait(lock);
+        } else {
+          cv_.wait_until(lock, wake);
+        }
+      }
+      if (exit_) {
+        // 退出时排队中的截图按未放行处理，保证回调都被调用
+        for (auto &[host, queue] : queues_) {
+          for (auto &p : queue) expired.push_back(std::move(p.fn));
+        }
+        queues_.clear();
+        stop = true;
+      }
+    }
+    for (auto &fn : expired) fn(false);
+    for (auto &fn : admitted) fn(true);
+  }
+}
+
+json UpstreamLimiter::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto now = Clock::now();
+  json upstreams = json::object();
+  size_t waiting = 0;
+  for (auto &[key, gate] : gates_) {
+    auto retry_at = Clock::time_point::max();
+    can_admit_locked(&gate, now, retry_at);
+    auto q = queues_.find(key);
+    size_t queue_depth = q != queues_.end() ? q->second.size() : 0;
+    upstreams[key] = {{"active", gate.active},
+                      {"peak_active", gate.peak_active},
+                      {"max_concurrent", gate.limit.max_concurrent},
+                      {"rate_per_sec", gate.limit.rate_per_sec},
+                      {"tokens", gate.tokens},
+                      {"queue_depth", queue_depth},
+                      {"admitted", gate.admitted},
+                      {"queued", gate.queued},
+                      {"timed_out", gate.timed_out}};
+  }
+  for (const auto &[host, queue] : queues_) waiting += queue.size();
+  return json{{"max_concurrent_per_host", opts_.per_host.max_concurrent},
+              {"rate_per_sec_per_host", opts_.per_host.rate_per_sec},
+              {"waiting", waiting},
+              {"upstreams", upstreams}};
+}
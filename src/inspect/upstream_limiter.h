@@ -0,0 +1,89 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+
+// 上游（NVR、流媒体服务器）截图限流：按 rtsp_url 中的主机（及可选的
+// 主机:端口）限制同时进行的实时截图数，并用令牌桶限制建连速率。名额不足
+// 的截图在各主机的队列中等待，按主机轮转放行，一台饱和的 NVR 不会挡住
+// 其他空闲主机上的摄像头；等到截止时间仍未放行的直接回调失败。
+class UpstreamLimiter {
+ public:
+  struct Limit {
+    size_t max_concurrent = 0;  // 同时截图数上限，0表示不限
+    double rate_per_sec = 0;    // 令牌补充速率（次/秒），0表示不限速
+    double burst = 1;           // 令牌桶容量，允许的瞬时突发次数
+  };
+
+  struct Options {
+    Limit per_host;  // 未单独配置的主机使用的限制
+    // 单独配置的主机（"host"）或端点（"host:port"）限制；端点限制只对
+    // 单独配置的端点生效，与所属主机的限制同时满足才放行
+    std::map<std::string, Limit> overrides;
+  };
+
+  // admitted 为 false 表示截止时间前未能放行
+  using AdmitFn = std::function<void(bool admitted)>;
+
+  explicit UpstreamLimiter(const Options &opts);
+  ~UpstreamLimiter();
+  UpstreamLimiter(const UpstreamLimiter &) = delete;
+  UpstreamLimiter &operator=(const UpstreamLimiter &) = delete;
+
+  // 申请一次截图名额，放行时回调 fn(true)（可能在调用线程中直接回调）。
+  // 排队后的放行与超时回调在调度线程上执行，fn 不得阻塞，应只把后续
+  // 工作投递到其他线程。放行后截图结束须调用 release 归还名额
+  void acquire(const std::string &rtsp_url,
+               std::chrono::steady_clock::time_point deadline, AdmitFn fn);
+  void release(const std::string &rtsp_url);
+
+  // 从地址中解析主机与端口，端口缺省时按协议取默认值（rtsp 为554）；
+  // 不是网络地址时返回 false
+  static bool parse_upstream(const std::string &url, std::string &host,
+                             int &port);
+
+  // 各受限主机/端点的在途截图数、排队数、令牌余量与放行、超时次数
+  nlohmann::json stats();
+
+ private:
+  struct Gate {
+    Limit limit;
+    size_t active = 0;
+    size_t peak_active = 0;
+    double tokens = 0;
+    std::chrono::steady_clock::time_point refilled;
+    uint64_t admitted = 0;
+    uint64_t queued = 0;     // 需排队等待的申请次数
+    uint64_t timed_out = 0;  // 排队到截止时间仍未放行的次数
+  };
+  struct Pending {
+    Gate *host_gate = nullptr;
+    Gate *endpoint_gate = nullptr;
+    std::chrono::steady_clock::time_point deadline;
+    AdmitFn fn;
+  };
+
+  void dispatch_loop();
+  void gates_locked(const std::string &rtsp_url, Gate *&host_gate,
+                    Gate *&endpoint_gate, std::string &host);
+  Gate *gate_locked(const std::string &key, const Limit &limit);
+  bool can_admit_locked(Gate *gate, std::chrono::steady_clock::time_point now,
+                        std::chrono::steady_clock::time_point &retry_at);
+  void admit_locked(Gate *gate);
+
+  Options opts_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::map<std::string, Gate> gates_;                  // host 或 host:port
+  std::map<std::string, std::deque<Pending>> queues_;  // 按主机排队
+  std::string cursor_;  // 上次放行的主机，下一轮从其后开始
+  bool exit_ = false;
+  std::thread dispatcher_;
+};
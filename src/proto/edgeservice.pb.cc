@@ -1,3282 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: edgeservice.proto
-// Protobuf C++ Version: 5.29.3
-
-#include "edgeservice.pb.h"
-
-#include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace edgeservice {
-
-inline constexpr GetResultRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : task_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetResultRequest::GetResultRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetResultRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetResultRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetResultRequestDefaultTypeInternal() {}
-  union {
-    GetResultRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetResultRequestDefaultTypeInternal _GetResultRequest_default_instance_;
-
-inline constexpr GenPlayUrlResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : play_url_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        msg_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        code_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GenPlayUrlResponse::GenPlayUrlResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GenPlayUrlResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GenPlayUrlResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GenPlayUrlResponseDefaultTypeInternal() {}
-  union {
-    GenPlayUrlResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GenPlayUrlResponseDefaultTypeInternal _GenPlayUrlResponse_default_instance_;
-
-inline constexpr GenPlayUrlRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : play_host_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        camera_id_{::uint64_t{0u}},
-        play_port_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GenPlayUrlRequest::GenPlayUrlRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GenPlayUrlRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GenPlayUrlRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GenPlayUrlRequestDefaultTypeInternal() {}
-  union {
-    GenPlayUrlRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GenPlayUrlRequestDefaultTypeInternal _GenPlayUrlRequest_default_instance_;
-
-inline constexpr CaptureResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : msg_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        code_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CaptureResponse::CaptureResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CaptureResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CaptureResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CaptureResponseDefaultTypeInternal() {}
-  union {
-    CaptureResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CaptureResponseDefaultTypeInternal _CaptureResponse_default_instance_;
-
-inline constexpr CaptureRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : rtsp_url_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        camera_id_{::uint64_t{0u}},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CaptureRequest::CaptureRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CaptureRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CaptureRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CaptureRequestDefaultTypeInternal() {}
-  union {
-    CaptureRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CaptureRequestDefaultTypeInternal _CaptureRequest_default_instance_;
-
-inline constexpr CameraInfo::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : rtsp_url_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        camera_id_{::uint64_t{0u}},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CameraInfo::CameraInfo(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CameraInfoDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CameraInfoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CameraInfoDefaultTypeInternal() {}
-  union {
-    CameraInfo _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CameraInfoDefaultTypeInternal _CameraInfo_default_instance_;
-
-inline constexpr CameraCheckResult::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : msg_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        camera_id_{::uint64_t{0u}},
-        code_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CameraCheckResult::CameraCheckResult(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CameraCheckResultDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CameraCheckResultDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CameraCheckResultDefaultTypeInternal() {}
-  union {
-    CameraCheckResult _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CameraCheckResultDefaultTypeInternal _CameraCheckResult_default_instance_;
-
-inline constexpr AsyncCaptureResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : msg_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        task_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        code_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AsyncCaptureResponse::AsyncCaptureResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AsyncCaptureResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AsyncCaptureResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AsyncCaptureResponseDefaultTypeInternal() {}
-  union {
-    AsyncCaptureResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AsyncCaptureResponseDefaultTypeInternal _AsyncCaptureResponse_default_instance_;
-
-inline constexpr GetResultResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : results_{},
-        msg_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        task_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        code_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetResultResponse::GetResultResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetResultResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetResultResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetResultResponseDefaultTypeInternal() {}
-  union {
-    GetResultResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetResultResponseDefaultTypeInternal _GetResultResponse_default_instance_;
-
-inline constexpr AsyncCaptureRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : cameras_{},
-        timeout_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AsyncCaptureRequest::AsyncCaptureRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AsyncCaptureRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AsyncCaptureRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AsyncCaptureRequestDefaultTypeInternal() {}
-  union {
-    AsyncCaptureRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AsyncCaptureRequestDefaultTypeInternal _AsyncCaptureRequest_default_instance_;
-}  // namespace edgeservice
-static constexpr const ::_pb::EnumDescriptor**
-    file_level_enum_descriptors_edgeservice_2eproto = nullptr;
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_edgeservice_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_edgeservice_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CaptureRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CaptureRequest, _impl_.camera_id_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CaptureRequest, _impl_.rtsp_url_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CaptureResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CaptureResponse, _impl_.code_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CaptureResponse, _impl_.msg_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CameraInfo, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CameraInfo, _impl_.camera_id_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CameraInfo, _impl_.rtsp_url_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::edgeservice::AsyncCaptureRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::edgeservice::AsyncCaptureRequest, _impl_.cameras_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::AsyncCaptureRequest, _impl_.timeout_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::edgeservice::AsyncCaptureResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::edgeservice::AsyncCaptureResponse, _impl_.code_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::AsyncCaptureResponse, _impl_.msg_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::AsyncCaptureResponse, _impl_.task_id_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GetResultRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GetResultRequest, _impl_.task_id_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CameraCheckResult, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CameraCheckResult, _impl_.camera_id_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CameraCheckResult, _impl_.code_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::CameraCheckResult, _impl_.msg_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GetResultResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GetResultResponse, _impl_.code_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GetResultResponse, _impl_.msg_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GetResultResponse, _impl_.task_id_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GetResultResponse, _impl_.results_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GenPlayUrlRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GenPlayUrlRequest, _impl_.camera_id_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GenPlayUrlRequest, _impl_.play_host_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GenPlayUrlRequest, _impl_.play_port_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GenPlayUrlResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GenPlayUrlResponse, _impl_.play_url_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GenPlayUrlResponse, _impl_.code_),
-        PROTOBUF_FIELD_OFFSET(::edgeservice::GenPlayUrlResponse, _impl_.msg_),
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::edgeservice::CaptureRequest)},
-        {10, -1, -1, sizeof(::edgeservice::CaptureResponse)},
-        {20, -1, -1, sizeof(::edgeservice::CameraInfo)},
-        {30, -1, -1, sizeof(::edgeservice::AsyncCaptureRequest)},
-        {40, -1, -1, sizeof(::edgeservice::AsyncCaptureResponse)},
-        {51, -1, -1, sizeof(::edgeservice::GetResultRequest)},
-        {60, -1, -1, sizeof(::edgeservice::CameraCheckResult)},
-        {71, -1, -1, sizeof(::edgeservice::GetResultResponse)},
-        {83, -1, -1, sizeof(::edgeservice::GenPlayUrlRequest)},
-        {94, -1, -1, sizeof(::edgeservice::GenPlayUrlResponse)},
-};
-static const ::_pb::Message* const file_default_instances[] = {
-    &::edgeservice::_CaptureRequest_default_instance_._instance,
-    &::edgeservice::_CaptureResponse_default_instance_._instance,
-    &::edgeservice::_CameraInfo_default_instance_._instance,
-    &::edgeservice::_AsyncCaptureRequest_default_instance_._instance,
-    &::edgeservice::_AsyncCaptureResponse_default_instance_._instance,
-    &::edgeservice::_GetResultRequest_default_instance_._instance,
-    &::edgeservice::_CameraCheckResult_default_instance_._instance,
-    &::edgeservice::_GetResultResponse_default_instance_._instance,
-    &::edgeservice::_GenPlayUrlRequest_default_instance_._instance,
-    &::edgeservice::_GenPlayUrlResponse_default_instance_._instance,
-};
-const char descriptor_table_protodef_edgeservice_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\021edgeservice.proto\022\013edgeservice\"5\n\016Capt"
-    "ureRequest\022\021\n\tcamera_id\030\001 \001(\004\022\020\n\010rtsp_ur"
-    "l\030\002 \001(\t\",\n\017CaptureResponse\022\014\n\004code\030\001 \001(\005"
-    "\022\013\n\003msg\030\002 \001(\t\"1\n\nCameraInfo\022\021\n\tcamera_id"
-    "\030\001 \001(\004\022\020\n\010rtsp_url\030\002 \001(\t\"P\n\023AsyncCapture"
-    "Request\022(\n\007cameras\030\001 \003(\0132\027.edgeservice.C"
-    "ameraInfo\022\017\n\007timeout\030\002 \001(\005\"B\n\024AsyncCaptu"
-    "reResponse\022\014\n\004code\030\001 \001(\005\022\013\n\003msg\030\002 \001(\t\022\017\n"
-    "\007task_id\030\003 \001(\t\"#\n\020GetResultRequest\022\017\n\007ta"
-    "sk_id\030\001 \001(\t\"A\n\021CameraCheckResult\022\021\n\tcame"
-    "ra_id\030\001 \001(\004\022\014\n\004code\030\002 \001(\005\022\013\n\003msg\030\003 \001(\t\"p"
-    "\n\021GetResultResponse\022\014\n\004code\030\001 \001(\005\022\013\n\003msg"
-    "\030\002 \001(\t\022\017\n\007task_id\030\003 \001(\t\022/\n\007results\030\004 \003(\013"
-    "2\036.edgeservice.CameraCheckResult\"L\n\021GenP"
-    "layUrlRequest\022\021\n\tcamera_id\030\001 \001(\004\022\021\n\tplay"
-    "_host\030\002 \001(\t\022\021\n\tplay_port\030\003 \001(\005\"A\n\022GenPla"
-    "yUrlResponse\022\020\n\010play_url\030\001 \001(\t\022\014\n\004code\030\002"
-    " \001(\005\022\013\n\003msg\030\003 \001(\t2\351\002\n\rCameraService\022L\n\017C"
-    "aptureAndCheck\022\033.edgeservice.CaptureRequ"
-    "est\032\034.edgeservice.CaptureResponse\022[\n\024Asy"
-    "ncCaptureAndCheck\022 .edgeservice.AsyncCap"
-    "tureRequest\032!.edgeservice.AsyncCaptureRe"
-    "sponse\022^\n\035GetAsyncCaptureAndCheckResult\022"
-    "\035.edgeservice.GetResultRequest\032\036.edgeser"
-    "vice.GetResultResponse\022M\n\nGenPlayUrl\022\036.e"
-    "dgeservice.GenPlayUrlRequest\032\037.edgeservi"
-    "ce.GenPlayUrlResponseb\006proto3"
-};
-static ::absl::once_flag descriptor_table_edgeservice_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_edgeservice_2eproto = {
-    false,
-    false,
-    1069,
-    descriptor_table_protodef_edgeservice_2eproto,
-    "edgeservice.proto",
-    &descriptor_table_edgeservice_2eproto_once,
-    nullptr,
-    0,
-    10,
-    schemas,
-    file_default_instances,
-    TableStruct_edgeservice_2eproto::offsets,
-    file_level_enum_descriptors_edgeservice_2eproto,
-    file_level_service_descriptors_edgeservice_2eproto,
-};
-namespace edgeservice {
-// ===================================================================
-
-class CaptureRequest::_Internal {
- public:
-};
-
-CaptureRequest::CaptureRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:edgeservice.CaptureRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CaptureRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::edgeservice::CaptureRequest& from_msg)
-      : rtsp_url_(arena, from.rtsp_url_),
-        _cached_size_{0} {}
-
-CaptureRequest::CaptureRequest(
-    ::google::protobuf::Arena* arena,
-    const CaptureRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CaptureRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.camera_id_ = from._impl_.camera_id_;
-
-  // @@protoc_insertion_point(copy_constructor:edgeservice.CaptureRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CaptureRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : rtsp_url_(arena),
-        _cached_size_{0} {}
-
-inline void CaptureRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.camera_id_ = {};
-}
-CaptureRequest::~CaptureRequest() {
-  // @@protoc_insertion_point(destructor:edgeservice.CaptureRequest)
-  SharedDtor(*this);
-}
-inline void CaptureRequest::SharedDtor(MessageLite& self) {
-  CaptureRequest& this_ = static_cast<CaptureRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.rtsp_url_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CaptureRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CaptureRequest(arena);
-}
-constexpr auto CaptureRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CaptureRequest),
-                                            alignof(CaptureRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CaptureRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CaptureRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CaptureRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CaptureRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CaptureRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CaptureRequest>(), &CaptureRequest::ByteSizeLong,
-            &CaptureRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CaptureRequest, _impl_._cached_size_),
-        false,
-    },
-    &CaptureRequest::kDescriptorMethods,
-    &descriptor_table_edgeservice_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CaptureRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 43, 2> CaptureRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::edgeservice::CaptureRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string rtsp_url = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureRequest, _impl_.rtsp_url_)}},
-    // uint64 camera_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CaptureRequest, _impl_.camera_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureRequest, _impl_.camera_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // uint64 camera_id = 1;
-    {PROTOBUF_FIELD_OFFSET(CaptureRequest, _impl_.camera_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-    // string rtsp_url = 2;
-    {PROTOBUF_FIELD_OFFSET(CaptureRequest, _impl_.rtsp_url_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\32\0\10\0\0\0\0\0"
-    "edgeservice.CaptureRequest"
-    "rtsp_url"
-  }},
-};
-
-PROTOBUF_NOINLINE void CaptureRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:edgeservice.CaptureRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.rtsp_url_.ClearToEmpty();
-  _impl_.camera_id_ = ::uint64_t{0u};
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CaptureRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CaptureRequest& this_ = static_cast<const CaptureRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CaptureRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CaptureRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:edgeservice.CaptureRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // uint64 camera_id = 1;
-          if (this_._internal_camera_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                1, this_._internal_camera_id(), target);
-          }
-
-          // string rtsp_url = 2;
-          if (!this_._internal_rtsp_url().empty()) {
-            const std::string& _s = this_._internal_rtsp_url();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.CaptureRequest.rtsp_url");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:edgeservice.CaptureRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CaptureRequest::ByteSizeLong(const MessageLite& base) {
-          const CaptureRequest& this_ = static_cast<const CaptureRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CaptureRequest::ByteSizeLong() const {
-          const CaptureRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:edgeservice.CaptureRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string rtsp_url = 2;
-            if (!this_._internal_rtsp_url().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_rtsp_url());
-            }
-            // uint64 camera_id = 1;
-            if (this_._internal_camera_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_camera_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CaptureRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CaptureRequest*>(&to_msg);
-  auto& from = static_cast<const CaptureRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:edgeservice.CaptureRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_rtsp_url().empty()) {
-    _this->_internal_set_rtsp_url(from._internal_rtsp_url());
-  }
-  if (from._internal_camera_id() != 0) {
-    _this->_impl_.camera_id_ = from._impl_.camera_id_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CaptureRequest::CopyFrom(const CaptureRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:edgeservice.CaptureRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CaptureRequest::InternalSwap(CaptureRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.rtsp_url_, &other->_impl_.rtsp_url_, arena);
-        swap(_impl_.camera_id_, other->_impl_.camera_id_);
-}
-
-::google::protobuf::Metadata CaptureRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CaptureResponse::_Internal {
- public:
-};
-
-CaptureResponse::CaptureResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:edgeservice.CaptureResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE CaptureResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::edgeservice::CaptureResponse& from_msg)
-      : msg_(arena, from.msg_),
-        _cached_size_{0} {}
-
-CaptureResponse::CaptureResponse(
-    ::google::protobuf::Arena* arena,
-    const CaptureResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CaptureResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.code_ = from._impl_.code_;
-
-  // @@protoc_insertion_point(copy_constructor:edgeservice.CaptureResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE CaptureResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : msg_(arena),
-        _cached_size_{0} {}
-
-inline void CaptureResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.code_ = {};
-}
-CaptureResponse::~CaptureResponse() {
-  // @@protoc_insertion_point(destructor:edgeservice.CaptureResponse)
-  SharedDtor(*this);
-}
-inline void CaptureResponse::SharedDtor(MessageLite& self) {
-  CaptureResponse& this_ = static_cast<CaptureResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.msg_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CaptureResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CaptureResponse(arena);
-}
-constexpr auto CaptureResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CaptureResponse),
-                                            alignof(CaptureResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CaptureResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CaptureResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CaptureResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CaptureResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CaptureResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CaptureResponse>(), &CaptureResponse::ByteSizeLong,
-            &CaptureResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CaptureResponse, _impl_._cached_size_),
-        false,
-    },
-    &CaptureResponse::kDescriptorMethods,
-    &descriptor_table_edgeservice_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CaptureResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 39, 2> CaptureResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::edgeservice::CaptureResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string msg = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureResponse, _impl_.msg_)}},
-    // int32 code = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CaptureResponse, _impl_.code_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureResponse, _impl_.code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 code = 1;
-    {PROTOBUF_FIELD_OFFSET(CaptureResponse, _impl_.code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string msg = 2;
-    {PROTOBUF_FIELD_OFFSET(CaptureResponse, _impl_.msg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\33\0\3\0\0\0\0\0"
-    "edgeservice.CaptureResponse"
-    "msg"
-  }},
-};
-
-PROTOBUF_NOINLINE void CaptureResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:edgeservice.CaptureResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.msg_.ClearToEmpty();
-  _impl_.code_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CaptureResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CaptureResponse& this_ = static_cast<const CaptureResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CaptureResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CaptureResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:edgeservice.CaptureResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 code = 1;
-          if (this_._internal_code() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_code(), target);
-          }
-
-          // string msg = 2;
-          if (!this_._internal_msg().empty()) {
-            const std::string& _s = this_._internal_msg();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.CaptureResponse.msg");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:edgeservice.CaptureResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CaptureResponse::ByteSizeLong(const MessageLite& base) {
-          const CaptureResponse& this_ = static_cast<const CaptureResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CaptureResponse::ByteSizeLong() const {
-          const CaptureResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:edgeservice.CaptureResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string msg = 2;
-            if (!this_._internal_msg().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_msg());
-            }
-            // int32 code = 1;
-            if (this_._internal_code() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CaptureResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CaptureResponse*>(&to_msg);
-  auto& from = static_cast<const CaptureResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:edgeservice.CaptureResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_msg().empty()) {
-    _this->_internal_set_msg(from._internal_msg());
-  }
-  if (from._internal_code() != 0) {
-    _this->_impl_.code_ = from._impl_.code_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CaptureResponse::CopyFrom(const CaptureResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:edgeservice.CaptureResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CaptureResponse::InternalSwap(CaptureResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msg_, &other->_impl_.msg_, arena);
-        swap(_impl_.code_, other->_impl_.code_);
-}
-
-::google::protobuf::Metadata CaptureResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CameraInfo::_Internal {
- public:
-};
-
-CameraInfo::CameraInfo(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:edgeservice.CameraInfo)
-}
-inline PROTOBUF_NDEBUG_INLINE CameraInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::edgeservice::CameraInfo& from_msg)
-      : rtsp_url_(arena, from.rtsp_url_),
-        _cached_size_{0} {}
-
-CameraInfo::CameraInfo(
-    ::google::protobuf::Arena* arena,
-    const CameraInfo& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CameraInfo* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.camera_id_ = from._impl_.camera_id_;
-
-  // @@protoc_insertion_point(copy_constructor:edgeservice.CameraInfo)
-}
-inline PROTOBUF_NDEBUG_INLINE CameraInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : rtsp_url_(arena),
-        _cached_size_{0} {}
-
-inline void CameraInfo::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.camera_id_ = {};
-}
-CameraInfo::~CameraInfo() {
-  // @@protoc_insertion_point(destructor:edgeservice.CameraInfo)
-  SharedDtor(*this);
-}
-inline void CameraInfo::SharedDtor(MessageLite& self) {
-  CameraInfo& this_ = static_cast<CameraInfo&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.rtsp_url_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CameraInfo::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CameraInfo(arena);
-}
-constexpr auto CameraInfo::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CameraInfo),
-                                            alignof(CameraInfo));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CameraInfo::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CameraInfo_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CameraInfo::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CameraInfo>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CameraInfo::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CameraInfo>(), &CameraInfo::ByteSizeLong,
-            &CameraInfo::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CameraInfo, _impl_._cached_size_),
-        false,
-    },
-    &CameraInfo::kDescriptorMethods,
-    &descriptor_table_edgeservice_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CameraInfo::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 39, 2> CameraInfo::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::edgeservice::CameraInfo>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string rtsp_url = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CameraInfo, _impl_.rtsp_url_)}},
-    // uint64 camera_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CameraInfo, _impl_.camera_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(CameraInfo, _impl_.camera_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // uint64 camera_id = 1;
-    {PROTOBUF_FIELD_OFFSET(CameraInfo, _impl_.camera_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-    // string rtsp_url = 2;
-    {PROTOBUF_FIELD_OFFSET(CameraInfo, _impl_.rtsp_url_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\26\0\10\0\0\0\0\0"
-    "edgeservice.CameraInfo"
-    "rtsp_url"
-  }},
-};
-
-PROTOBUF_NOINLINE void CameraInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:edgeservice.CameraInfo)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.rtsp_url_.ClearToEmpty();
-  _impl_.camera_id_ = ::uint64_t{0u};
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CameraInfo::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CameraInfo& this_ = static_cast<const CameraInfo&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CameraInfo::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CameraInfo& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:edgeservice.CameraInfo)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // uint64 camera_id = 1;
-          if (this_._internal_camera_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                1, this_._internal_camera_id(), target);
-          }
-
-          // string rtsp_url = 2;
-          if (!this_._internal_rtsp_url().empty()) {
-            const std::string& _s = this_._internal_rtsp_url();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.CameraInfo.rtsp_url");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:edgeservice.CameraInfo)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CameraInfo::ByteSizeLong(const MessageLite& base) {
-          const CameraInfo& this_ = static_cast<const CameraInfo&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CameraInfo::ByteSizeLong() const {
-          const CameraInfo& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:edgeservice.CameraInfo)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string rtsp_url = 2;
-            if (!this_._internal_rtsp_url().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_rtsp_url());
-            }
-            // uint64 camera_id = 1;
-            if (this_._internal_camera_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_camera_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CameraInfo::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CameraInfo*>(&to_msg);
-  auto& from = static_cast<const CameraInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:edgeservice.CameraInfo)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_rtsp_url().empty()) {
-    _this->_internal_set_rtsp_url(from._internal_rtsp_url());
-  }
-  if (from._internal_camera_id() != 0) {
-    _this->_impl_.camera_id_ = from._impl_.camera_id_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CameraInfo::CopyFrom(const CameraInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:edgeservice.CameraInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CameraInfo::InternalSwap(CameraInfo* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.rtsp_url_, &other->_impl_.rtsp_url_, arena);
-        swap(_impl_.camera_id_, other->_impl_.camera_id_);
-}
-
-::google::protobuf::Metadata CameraInfo::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AsyncCaptureRequest::_Internal {
- public:
-};
-
-AsyncCaptureRequest::AsyncCaptureRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:edgeservice.AsyncCaptureRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE AsyncCaptureRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::edgeservice::AsyncCaptureRequest& from_msg)
-      : cameras_{visibility, arena, from.cameras_},
-        _cached_size_{0} {}
-
-AsyncCaptureRequest::AsyncCaptureRequest(
-    ::google::protobuf::Arena* arena,
-    const AsyncCaptureRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  AsyncCaptureRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.timeout_ = from._impl_.timeout_;
-
-  // @@protoc_insertion_point(copy_constructor:edgeservice.AsyncCaptureRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE AsyncCaptureRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : cameras_{visibility, arena},
-        _cached_size_{0} {}
-
-inline void AsyncCaptureRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.timeout_ = {};
-}
-AsyncCaptureRequest::~AsyncCaptureRequest() {
-  // @@protoc_insertion_point(destructor:edgeservice.AsyncCaptureRequest)
-  SharedDtor(*this);
-}
-inline void AsyncCaptureRequest::SharedDtor(MessageLite& self) {
-  AsyncCaptureRequest& this_ = static_cast<AsyncCaptureRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* AsyncCaptureRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AsyncCaptureRequest(arena);
-}
-constexpr auto AsyncCaptureRequest::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(AsyncCaptureRequest, _impl_.cameras_) +
-          decltype(AsyncCaptureRequest::_impl_.cameras_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(AsyncCaptureRequest), alignof(AsyncCaptureRequest), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&AsyncCaptureRequest::PlacementNew_,
-                                 sizeof(AsyncCaptureRequest),
-                                 alignof(AsyncCaptureRequest));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AsyncCaptureRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AsyncCaptureRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AsyncCaptureRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AsyncCaptureRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AsyncCaptureRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AsyncCaptureRequest>(), &AsyncCaptureRequest::ByteSizeLong,
-            &AsyncCaptureRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AsyncCaptureRequest, _impl_._cached_size_),
-        false,
-    },
-    &AsyncCaptureRequest::kDescriptorMethods,
-    &descriptor_table_edgeservice_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AsyncCaptureRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 0, 2> AsyncCaptureRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::edgeservice::AsyncCaptureRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 timeout = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AsyncCaptureRequest, _impl_.timeout_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(AsyncCaptureRequest, _impl_.timeout_)}},
-    // repeated .edgeservice.CameraInfo cameras = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(AsyncCaptureRequest, _impl_.cameras_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // repeated .edgeservice.CameraInfo cameras = 1;
-    {PROTOBUF_FIELD_OFFSET(AsyncCaptureRequest, _impl_.cameras_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // int32 timeout = 2;
-    {PROTOBUF_FIELD_OFFSET(AsyncCaptureRequest, _impl_.timeout_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::edgeservice::CameraInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void AsyncCaptureRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:edgeservice.AsyncCaptureRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.cameras_.Clear();
-  _impl_.timeout_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AsyncCaptureRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AsyncCaptureRequest& this_ = static_cast<const AsyncCaptureRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AsyncCaptureRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AsyncCaptureRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:edgeservice.AsyncCaptureRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // repeated .edgeservice.CameraInfo cameras = 1;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_cameras_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_cameras().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    1, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // int32 timeout = 2;
-          if (this_._internal_timeout() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_timeout(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:edgeservice.AsyncCaptureRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AsyncCaptureRequest::ByteSizeLong(const MessageLite& base) {
-          const AsyncCaptureRequest& this_ = static_cast<const AsyncCaptureRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AsyncCaptureRequest::ByteSizeLong() const {
-          const AsyncCaptureRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:edgeservice.AsyncCaptureRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .edgeservice.CameraInfo cameras = 1;
-            {
-              total_size += 1UL * this_._internal_cameras_size();
-              for (const auto& msg : this_._internal_cameras()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // int32 timeout = 2;
-            if (this_._internal_timeout() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_timeout());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AsyncCaptureRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AsyncCaptureRequest*>(&to_msg);
-  auto& from = static_cast<const AsyncCaptureRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:edgeservice.AsyncCaptureRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_cameras()->MergeFrom(
-      from._internal_cameras());
-  if (from._internal_timeout() != 0) {
-    _this->_impl_.timeout_ = from._impl_.timeout_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AsyncCaptureRequest::CopyFrom(const AsyncCaptureRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:edgeservice.AsyncCaptureRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AsyncCaptureRequest::InternalSwap(AsyncCaptureRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.cameras_.InternalSwap(&other->_impl_.cameras_);
-        swap(_impl_.timeout_, other->_impl_.timeout_);
-}
-
-::google::protobuf::Metadata AsyncCaptureRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AsyncCaptureResponse::_Internal {
- public:
-};
-
-AsyncCaptureResponse::AsyncCaptureResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:edgeservice.AsyncCaptureResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE AsyncCaptureResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::edgeservice::AsyncCaptureResponse& from_msg)
-      : msg_(arena, from.msg_),
-        task_id_(arena, from.task_id_),
-        _cached_size_{0} {}
-
-AsyncCaptureResponse::AsyncCaptureResponse(
-    ::google::protobuf::Arena* arena,
-    const AsyncCaptureResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  AsyncCaptureResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.code_ = from._impl_.code_;
-
-  // @@protoc_insertion_point(copy_constructor:edgeservice.AsyncCaptureResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE AsyncCaptureResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : msg_(arena),
-        task_id_(arena),
-        _cached_size_{0} {}
-
-inline void AsyncCaptureResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.code_ = {};
-}
-AsyncCaptureResponse::~AsyncCaptureResponse() {
-  // @@protoc_insertion_point(destructor:edgeservice.AsyncCaptureResponse)
-  SharedDtor(*this);
-}
-inline void AsyncCaptureResponse::SharedDtor(MessageLite& self) {
-  AsyncCaptureResponse& this_ = static_cast<AsyncCaptureResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.msg_.Destroy();
-  this_._impl_.task_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* AsyncCaptureResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) AsyncCaptureResponse(arena);
-}
-constexpr auto AsyncCaptureResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AsyncCaptureResponse),
-                                            alignof(AsyncCaptureResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull AsyncCaptureResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_AsyncCaptureResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &AsyncCaptureResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<AsyncCaptureResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &AsyncCaptureResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<AsyncCaptureResponse>(), &AsyncCaptureResponse::ByteSizeLong,
-            &AsyncCaptureResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(AsyncCaptureResponse, _impl_._cached_size_),
-        false,
-    },
-    &AsyncCaptureResponse::kDescriptorMethods,
-    &descriptor_table_edgeservice_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* AsyncCaptureResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 51, 2> AsyncCaptureResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::edgeservice::AsyncCaptureResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 code = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AsyncCaptureResponse, _impl_.code_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(AsyncCaptureResponse, _impl_.code_)}},
-    // string msg = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(AsyncCaptureResponse, _impl_.msg_)}},
-    // string task_id = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(AsyncCaptureResponse, _impl_.task_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 code = 1;
-    {PROTOBUF_FIELD_OFFSET(AsyncCaptureResponse, _impl_.code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string msg = 2;
-    {PROTOBUF_FIELD_OFFSET(AsyncCaptureResponse, _impl_.msg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string task_id = 3;
-    {PROTOBUF_FIELD_OFFSET(AsyncCaptureResponse, _impl_.task_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\40\0\3\7\0\0\0\0"
-    "edgeservice.AsyncCaptureResponse"
-    "msg"
-    "task_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void AsyncCaptureResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:edgeservice.AsyncCaptureResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.msg_.ClearToEmpty();
-  _impl_.task_id_.ClearToEmpty();
-  _impl_.code_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* AsyncCaptureResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const AsyncCaptureResponse& this_ = static_cast<const AsyncCaptureResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* AsyncCaptureResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const AsyncCaptureResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:edgeservice.AsyncCaptureResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 code = 1;
-          if (this_._internal_code() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_code(), target);
-          }
-
-          // string msg = 2;
-          if (!this_._internal_msg().empty()) {
-            const std::string& _s = this_._internal_msg();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.AsyncCaptureResponse.msg");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string task_id = 3;
-          if (!this_._internal_task_id().empty()) {
-            const std::string& _s = this_._internal_task_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.AsyncCaptureResponse.task_id");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:edgeservice.AsyncCaptureResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t AsyncCaptureResponse::ByteSizeLong(const MessageLite& base) {
-          const AsyncCaptureResponse& this_ = static_cast<const AsyncCaptureResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t AsyncCaptureResponse::ByteSizeLong() const {
-          const AsyncCaptureResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:edgeservice.AsyncCaptureResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string msg = 2;
-            if (!this_._internal_msg().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_msg());
-            }
-            // string task_id = 3;
-            if (!this_._internal_task_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_task_id());
-            }
-            // int32 code = 1;
-            if (this_._internal_code() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void AsyncCaptureResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AsyncCaptureResponse*>(&to_msg);
-  auto& from = static_cast<const AsyncCaptureResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:edgeservice.AsyncCaptureResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_msg().empty()) {
-    _this->_internal_set_msg(from._internal_msg());
-  }
-  if (!from._internal_task_id().empty()) {
-    _this->_internal_set_task_id(from._internal_task_id());
-  }
-  if (from._internal_code() != 0) {
-    _this->_impl_.code_ = from._impl_.code_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AsyncCaptureResponse::CopyFrom(const AsyncCaptureResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:edgeservice.AsyncCaptureResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AsyncCaptureResponse::InternalSwap(AsyncCaptureResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msg_, &other->_impl_.msg_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.task_id_, &other->_impl_.task_id_, arena);
-        swap(_impl_.code_, other->_impl_.code_);
-}
-
-::google::protobuf::Metadata AsyncCaptureResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetResultRequest::_Internal {
- public:
-};
-
-GetResultRequest::GetResultRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:edgeservice.GetResultRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetResultRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::edgeservice::GetResultRequest& from_msg)
-      : task_id_(arena, from.task_id_),
-        _cached_size_{0} {}
-
-GetResultRequest::GetResultRequest(
-    ::google::protobuf::Arena* arena,
-    const GetResultRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetResultRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:edgeservice.GetResultRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetResultRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : task_id_(arena),
-        _cached_size_{0} {}
-
-inline void GetResultRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-GetResultRequest::~GetResultRequest() {
-  // @@protoc_insertion_point(destructor:edgeservice.GetResultRequest)
-  SharedDtor(*this);
-}
-inline void GetResultRequest::SharedDtor(MessageLite& self) {
-  GetResultRequest& this_ = static_cast<GetResultRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.task_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetResultRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetResultRequest(arena);
-}
-constexpr auto GetResultRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetResultRequest),
-                                            alignof(GetResultRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetResultRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetResultRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetResultRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetResultRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetResultRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetResultRequest>(), &GetResultRequest::ByteSizeLong,
-            &GetResultRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetResultRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetResultRequest::kDescriptorMethods,
-    &descriptor_table_edgeservice_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetResultRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 44, 2> GetResultRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::edgeservice::GetResultRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string task_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetResultRequest, _impl_.task_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string task_id = 1;
-    {PROTOBUF_FIELD_OFFSET(GetResultRequest, _impl_.task_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\34\7\0\0\0\0\0\0"
-    "edgeservice.GetResultRequest"
-    "task_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetResultRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:edgeservice.GetResultRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.task_id_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetResultRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetResultRequest& this_ = static_cast<const GetResultRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetResultRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetResultRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:edgeservice.GetResultRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string task_id = 1;
-          if (!this_._internal_task_id().empty()) {
-            const std::string& _s = this_._internal_task_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.GetResultRequest.task_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:edgeservice.GetResultRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetResultRequest::ByteSizeLong(const MessageLite& base) {
-          const GetResultRequest& this_ = static_cast<const GetResultRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetResultRequest::ByteSizeLong() const {
-          const GetResultRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:edgeservice.GetResultRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // string task_id = 1;
-            if (!this_._internal_task_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_task_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetResultRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetResultRequest*>(&to_msg);
-  auto& from = static_cast<const GetResultRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:edgeservice.GetResultRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_task_id().empty()) {
-    _this->_internal_set_task_id(from._internal_task_id());
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetResultRequest::CopyFrom(const GetResultRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:edgeservice.GetResultRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetResultRequest::InternalSwap(GetResultRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.task_id_, &other->_impl_.task_id_, arena);
-}
-
-::google::protobuf::Metadata GetResultRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CameraCheckResult::_Internal {
- public:
-};
-
-CameraCheckResult::CameraCheckResult(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:edgeservice.CameraCheckResult)
-}
-inline PROTOBUF_NDEBUG_INLINE CameraCheckResult::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::edgeservice::CameraCheckResult& from_msg)
-      : msg_(arena, from.msg_),
-        _cached_size_{0} {}
-
-CameraCheckResult::CameraCheckResult(
-    ::google::protobuf::Arena* arena,
-    const CameraCheckResult& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CameraCheckResult* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, camera_id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, camera_id_),
-           offsetof(Impl_, code_) -
-               offsetof(Impl_, camera_id_) +
-               sizeof(Impl_::code_));
-
-  // @@protoc_insertion_point(copy_constructor:edgeservice.CameraCheckResult)
-}
-inline PROTOBUF_NDEBUG_INLINE CameraCheckResult::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : msg_(arena),
-        _cached_size_{0} {}
-
-inline void CameraCheckResult::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, camera_id_),
-           0,
-           offsetof(Impl_, code_) -
-               offsetof(Impl_, camera_id_) +
-               sizeof(Impl_::code_));
-}
-CameraCheckResult::~CameraCheckResult() {
-  // @@protoc_insertion_point(destructor:edgeservice.CameraCheckResult)
-  SharedDtor(*this);
-}
-inline void CameraCheckResult::SharedDtor(MessageLite& self) {
-  CameraCheckResult& this_ = static_cast<CameraCheckResult&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.msg_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* CameraCheckResult::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CameraCheckResult(arena);
-}
-constexpr auto CameraCheckResult::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(CameraCheckResult),
-                                            alignof(CameraCheckResult));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CameraCheckResult::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CameraCheckResult_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CameraCheckResult::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CameraCheckResult>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CameraCheckResult::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CameraCheckResult>(), &CameraCheckResult::ByteSizeLong,
-            &CameraCheckResult::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CameraCheckResult, _impl_._cached_size_),
-        false,
-    },
-    &CameraCheckResult::kDescriptorMethods,
-    &descriptor_table_edgeservice_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CameraCheckResult::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 41, 2> CameraCheckResult::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::edgeservice::CameraCheckResult>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // uint64 camera_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CameraCheckResult, _impl_.camera_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(CameraCheckResult, _impl_.camera_id_)}},
-    // int32 code = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CameraCheckResult, _impl_.code_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(CameraCheckResult, _impl_.code_)}},
-    // string msg = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(CameraCheckResult, _impl_.msg_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // uint64 camera_id = 1;
-    {PROTOBUF_FIELD_OFFSET(CameraCheckResult, _impl_.camera_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-    // int32 code = 2;
-    {PROTOBUF_FIELD_OFFSET(CameraCheckResult, _impl_.code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string msg = 3;
-    {PROTOBUF_FIELD_OFFSET(CameraCheckResult, _impl_.msg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\35\0\0\3\0\0\0\0"
-    "edgeservice.CameraCheckResult"
-    "msg"
-  }},
-};
-
-PROTOBUF_NOINLINE void CameraCheckResult::Clear() {
-// @@protoc_insertion_point(message_clear_start:edgeservice.CameraCheckResult)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.msg_.ClearToEmpty();
-  ::memset(&_impl_.camera_id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.code_) -
-      reinterpret_cast<char*>(&_impl_.camera_id_)) + sizeof(_impl_.code_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CameraCheckResult::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CameraCheckResult& this_ = static_cast<const CameraCheckResult&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CameraCheckResult::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CameraCheckResult& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:edgeservice.CameraCheckResult)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // uint64 camera_id = 1;
-          if (this_._internal_camera_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                1, this_._internal_camera_id(), target);
-          }
-
-          // int32 code = 2;
-          if (this_._internal_code() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_code(), target);
-          }
-
-          // string msg = 3;
-          if (!this_._internal_msg().empty()) {
-            const std::string& _s = this_._internal_msg();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.CameraCheckResult.msg");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:edgeservice.CameraCheckResult)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CameraCheckResult::ByteSizeLong(const MessageLite& base) {
-          const CameraCheckResult& this_ = static_cast<const CameraCheckResult&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CameraCheckResult::ByteSizeLong() const {
-          const CameraCheckResult& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:edgeservice.CameraCheckResult)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string msg = 3;
-            if (!this_._internal_msg().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_msg());
-            }
-            // uint64 camera_id = 1;
-            if (this_._internal_camera_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_camera_id());
-            }
-            // int32 code = 2;
-            if (this_._internal_code() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CameraCheckResult::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CameraCheckResult*>(&to_msg);
-  auto& from = static_cast<const CameraCheckResult&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:edgeservice.CameraCheckResult)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_msg().empty()) {
-    _this->_internal_set_msg(from._internal_msg());
-  }
-  if (from._internal_camera_id() != 0) {
-    _this->_impl_.camera_id_ = from._impl_.camera_id_;
-  }
-  if (from._internal_code() != 0) {
-    _this->_impl_.code_ = from._impl_.code_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CameraCheckResult::CopyFrom(const CameraCheckResult& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:edgeservice.CameraCheckResult)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CameraCheckResult::InternalSwap(CameraCheckResult* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msg_, &other->_impl_.msg_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(CameraCheckResult, _impl_.code_)
-      + sizeof(CameraCheckResult::_impl_.code_)
-      - PROTOBUF_FIELD_OFFSET(CameraCheckResult, _impl_.camera_id_)>(
-          reinterpret_cast<char*>(&_impl_.camera_id_),
-          reinterpret_cast<char*>(&other->_impl_.camera_id_));
-}
-
-::google::protobuf::Metadata CameraCheckResult::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetResultResponse::_Internal {
- public:
-};
-
-GetResultResponse::GetResultResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:edgeservice.GetResultResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetResultResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::edgeservice::GetResultResponse& from_msg)
-      : results_{visibility, arena, from.results_},
-        msg_(arena, from.msg_),
-        task_id_(arena, from.task_id_),
-        _cached_size_{0} {}
-
-GetResultResponse::GetResultResponse(
-    ::google::protobuf::Arena* arena,
-    const GetResultResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetResultResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.code_ = from._impl_.code_;
-
-  // @@protoc_insertion_point(copy_constructor:edgeservice.GetResultResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetResultResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : results_{visibility, arena},
-        msg_(arena),
-        task_id_(arena),
-        _cached_size_{0} {}
-
-inline void GetResultResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.code_ = {};
-}
-GetResultResponse::~GetResultResponse() {
-  // @@protoc_insertion_point(destructor:edgeservice.GetResultResponse)
-  SharedDtor(*this);
-}
-inline void GetResultResponse::SharedDtor(MessageLite& self) {
-  GetResultResponse& this_ = static_cast<GetResultResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.msg_.Destroy();
-  this_._impl_.task_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GetResultResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetResultResponse(arena);
-}
-constexpr auto GetResultResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(GetResultResponse, _impl_.results_) +
-          decltype(GetResultResponse::_impl_.results_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(GetResultResponse), alignof(GetResultResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&GetResultResponse::PlacementNew_,
-                                 sizeof(GetResultResponse),
-                                 alignof(GetResultResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetResultResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetResultResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetResultResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetResultResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetResultResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetResultResponse>(), &GetResultResponse::ByteSizeLong,
-            &GetResultResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetResultResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetResultResponse::kDescriptorMethods,
-    &descriptor_table_edgeservice_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetResultResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 48, 2> GetResultResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::edgeservice::GetResultResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .edgeservice.CameraCheckResult results = 4;
-    {::_pbi::TcParser::FastMtR1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(GetResultResponse, _impl_.results_)}},
-    // int32 code = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetResultResponse, _impl_.code_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GetResultResponse, _impl_.code_)}},
-    // string msg = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetResultResponse, _impl_.msg_)}},
-    // string task_id = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GetResultResponse, _impl_.task_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 code = 1;
-    {PROTOBUF_FIELD_OFFSET(GetResultResponse, _impl_.code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string msg = 2;
-    {PROTOBUF_FIELD_OFFSET(GetResultResponse, _impl_.msg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string task_id = 3;
-    {PROTOBUF_FIELD_OFFSET(GetResultResponse, _impl_.task_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated .edgeservice.CameraCheckResult results = 4;
-    {PROTOBUF_FIELD_OFFSET(GetResultResponse, _impl_.results_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::edgeservice::CameraCheckResult>()},
-  }}, {{
-    "\35\0\3\7\0\0\0\0"
-    "edgeservice.GetResultResponse"
-    "msg"
-    "task_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetResultResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:edgeservice.GetResultResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.results_.Clear();
-  _impl_.msg_.ClearToEmpty();
-  _impl_.task_id_.ClearToEmpty();
-  _impl_.code_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetResultResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetResultResponse& this_ = static_cast<const GetResultResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetResultResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetResultResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:edgeservice.GetResultResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 code = 1;
-          if (this_._internal_code() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_code(), target);
-          }
-
-          // string msg = 2;
-          if (!this_._internal_msg().empty()) {
-            const std::string& _s = this_._internal_msg();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.GetResultResponse.msg");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string task_id = 3;
-          if (!this_._internal_task_id().empty()) {
-            const std::string& _s = this_._internal_task_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.GetResultResponse.task_id");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // repeated .edgeservice.CameraCheckResult results = 4;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_results_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_results().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    4, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:edgeservice.GetResultResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetResultResponse::ByteSizeLong(const MessageLite& base) {
-          const GetResultResponse& this_ = static_cast<const GetResultResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetResultResponse::ByteSizeLong() const {
-          const GetResultResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:edgeservice.GetResultResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .edgeservice.CameraCheckResult results = 4;
-            {
-              total_size += 1UL * this_._internal_results_size();
-              for (const auto& msg : this_._internal_results()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // string msg = 2;
-            if (!this_._internal_msg().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_msg());
-            }
-            // string task_id = 3;
-            if (!this_._internal_task_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_task_id());
-            }
-            // int32 code = 1;
-            if (this_._internal_code() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetResultResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetResultResponse*>(&to_msg);
-  auto& from = static_cast<const GetResultResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:edgeservice.GetResultResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_results()->MergeFrom(
-      from._internal_results());
-  if (!from._internal_msg().empty()) {
-    _this->_internal_set_msg(from._internal_msg());
-  }
-  if (!from._internal_task_id().empty()) {
-    _this->_internal_set_task_id(from._internal_task_id());
-  }
-  if (from._internal_code() != 0) {
-    _this->_impl_.code_ = from._impl_.code_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetResultResponse::CopyFrom(const GetResultResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:edgeservice.GetResultResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetResultResponse::InternalSwap(GetResultResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.results_.InternalSwap(&other->_impl_.results_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msg_, &other->_impl_.msg_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.task_id_, &other->_impl_.task_id_, arena);
-        swap(_impl_.code_, other->_impl_.code_);
-}
-
-::google::protobuf::Metadata GetResultResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GenPlayUrlRequest::_Internal {
- public:
-};
-
-GenPlayUrlRequest::GenPlayUrlRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:edgeservice.GenPlayUrlRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GenPlayUrlRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::edgeservice::GenPlayUrlRequest& from_msg)
-      : play_host_(arena, from.play_host_),
-        _cached_size_{0} {}
-
-GenPlayUrlRequest::GenPlayUrlRequest(
-    ::google::protobuf::Arena* arena,
-    const GenPlayUrlRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GenPlayUrlRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, camera_id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, camera_id_),
-           offsetof(Impl_, play_port_) -
-               offsetof(Impl_, camera_id_) +
-               sizeof(Impl_::play_port_));
-
-  // @@protoc_insertion_point(copy_constructor:edgeservice.GenPlayUrlRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GenPlayUrlRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : play_host_(arena),
-        _cached_size_{0} {}
-
-inline void GenPlayUrlRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, camera_id_),
-           0,
-           offsetof(Impl_, play_port_) -
-               offsetof(Impl_, camera_id_) +
-               sizeof(Impl_::play_port_));
-}
-GenPlayUrlRequest::~GenPlayUrlRequest() {
-  // @@protoc_insertion_point(destructor:edgeservice.GenPlayUrlRequest)
-  SharedDtor(*this);
-}
-inline void GenPlayUrlRequest::SharedDtor(MessageLite& self) {
-  GenPlayUrlRequest& this_ = static_cast<GenPlayUrlRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.play_host_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GenPlayUrlRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GenPlayUrlRequest(arena);
-}
-constexpr auto GenPlayUrlRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GenPlayUrlRequest),
-                                            alignof(GenPlayUrlRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GenPlayUrlRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GenPlayUrlRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GenPlayUrlRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GenPlayUrlRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GenPlayUrlRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GenPlayUrlRequest>(), &GenPlayUrlRequest::ByteSizeLong,
-            &GenPlayUrlRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GenPlayUrlRequest, _impl_._cached_size_),
-        false,
-    },
-    &GenPlayUrlRequest::kDescriptorMethods,
-    &descriptor_table_edgeservice_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GenPlayUrlRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 47, 2> GenPlayUrlRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::edgeservice::GenPlayUrlRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // uint64 camera_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GenPlayUrlRequest, _impl_.camera_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GenPlayUrlRequest, _impl_.camera_id_)}},
-    // string play_host = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GenPlayUrlRequest, _impl_.play_host_)}},
-    // int32 play_port = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GenPlayUrlRequest, _impl_.play_port_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(GenPlayUrlRequest, _impl_.play_port_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // uint64 camera_id = 1;
-    {PROTOBUF_FIELD_OFFSET(GenPlayUrlRequest, _impl_.camera_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-    // string play_host = 2;
-    {PROTOBUF_FIELD_OFFSET(GenPlayUrlRequest, _impl_.play_host_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 play_port = 3;
-    {PROTOBUF_FIELD_OFFSET(GenPlayUrlRequest, _impl_.play_port_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-    "\35\0\11\0\0\0\0\0"
-    "edgeservice.GenPlayUrlRequest"
-    "play_host"
-  }},
-};
-
-PROTOBUF_NOINLINE void GenPlayUrlRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:edgeservice.GenPlayUrlRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.play_host_.ClearToEmpty();
-  ::memset(&_impl_.camera_id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.play_port_) -
-      reinterpret_cast<char*>(&_impl_.camera_id_)) + sizeof(_impl_.play_port_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GenPlayUrlRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GenPlayUrlRequest& this_ = static_cast<const GenPlayUrlRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GenPlayUrlRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GenPlayUrlRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:edgeservice.GenPlayUrlRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // uint64 camera_id = 1;
-          if (this_._internal_camera_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                1, this_._internal_camera_id(), target);
-          }
-
-          // string play_host = 2;
-          if (!this_._internal_play_host().empty()) {
-            const std::string& _s = this_._internal_play_host();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.GenPlayUrlRequest.play_host");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // int32 play_port = 3;
-          if (this_._internal_play_port() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_play_port(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:edgeservice.GenPlayUrlRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GenPlayUrlRequest::ByteSizeLong(const MessageLite& base) {
-          const GenPlayUrlRequest& this_ = static_cast<const GenPlayUrlRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GenPlayUrlRequest::ByteSizeLong() const {
-          const GenPlayUrlRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:edgeservice.GenPlayUrlRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string play_host = 2;
-            if (!this_._internal_play_host().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_play_host());
-            }
-            // uint64 camera_id = 1;
-            if (this_._internal_camera_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_camera_id());
-            }
-            // int32 play_port = 3;
-            if (this_._internal_play_port() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_play_port());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GenPlayUrlRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GenPlayUrlRequest*>(&to_msg);
-  auto& from = static_cast<const GenPlayUrlRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:edgeservice.GenPlayUrlRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_play_host().empty()) {
-    _this->_internal_set_play_host(from._internal_play_host());
-  }
-  if (from._internal_camera_id() != 0) {
-    _this->_impl_.camera_id_ = from._impl_.camera_id_;
-  }
-  if (from._internal_play_port() != 0) {
-    _this->_impl_.play_port_ = from._impl_.play_port_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GenPlayUrlRequest::CopyFrom(const GenPlayUrlRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:edgeservice.GenPlayUrlRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GenPlayUrlRequest::InternalSwap(GenPlayUrlRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.play_host_, &other->_impl_.play_host_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GenPlayUrlRequest, _impl_.play_port_)
-      + sizeof(GenPlayUrlRequest::_impl_.play_port_)
-      - PROTOBUF_FIELD_OFFSET(GenPlayUrlRequest, _impl_.camera_id_)>(
-          reinterpret_cast<char*>(&_impl_.camera_id_),
-          reinterpret_cast<char*>(&other->_impl_.camera_id_));
-}
-
-::google::protobuf::Metadata GenPlayUrlRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GenPlayUrlResponse::_Internal {
- public:
-};
-
-GenPlayUrlResponse::GenPlayUrlResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:edgeservice.GenPlayUrlResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GenPlayUrlResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::edgeservice::GenPlayUrlResponse& from_msg)
-      : play_url_(arena, from.play_url_),
-        msg_(arena, from.msg_),
-        _cached_size_{0} {}
-
-GenPlayUrlResponse::GenPlayUrlResponse(
-    ::google::protobuf::Arena* arena,
-    const GenPlayUrlResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GenPlayUrlResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.code_ = from._impl_.code_;
-
-  // @@protoc_insertion_point(copy_constructor:edgeservice.GenPlayUrlResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GenPlayUrlResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : play_url_(arena),
-        msg_(arena),
-        _cached_size_{0} {}
-
-inline void GenPlayUrlResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.code_ = {};
-}
-GenPlayUrlResponse::~GenPlayUrlResponse() {
-  // @@protoc_insertion_point(destructor:edgeservice.GenPlayUrlResponse)
-  SharedDtor(*this);
-}
-inline void GenPlayUrlResponse::SharedDtor(MessageLite& self) {
-  GenPlayUrlResponse& this_ = static_cast<GenPlayUrlResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.play_url_.Destroy();
-  this_._impl_.msg_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GenPlayUrlResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GenPlayUrlResponse(arena);
-}
-constexpr auto GenPlayUrlResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GenPlayUrlResponse),
-                                            alignof(GenPlayUrlResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GenPlayUrlResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GenPlayUrlResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GenPlayUrlResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GenPlayUrlResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GenPlayUrlResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GenPlayUrlResponse>(), &GenPlayUrlResponse::ByteSizeLong,
-            &GenPlayUrlResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GenPlayUrlResponse, _impl_._cached_size_),
-        false,
-    },
-    &GenPlayUrlResponse::kDescriptorMethods,
-    &descriptor_table_edgeservice_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GenPlayUrlResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 50, 2> GenPlayUrlResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::edgeservice::GenPlayUrlResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string play_url = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GenPlayUrlResponse, _impl_.play_url_)}},
-    // int32 code = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GenPlayUrlResponse, _impl_.code_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(GenPlayUrlResponse, _impl_.code_)}},
-    // string msg = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GenPlayUrlResponse, _impl_.msg_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string play_url = 1;
-    {PROTOBUF_FIELD_OFFSET(GenPlayUrlResponse, _impl_.play_url_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 code = 2;
-    {PROTOBUF_FIELD_OFFSET(GenPlayUrlResponse, _impl_.code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string msg = 3;
-    {PROTOBUF_FIELD_OFFSET(GenPlayUrlResponse, _impl_.msg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\36\10\0\3\0\0\0\0"
-    "edgeservice.GenPlayUrlResponse"
-    "play_url"
-    "msg"
-  }},
-};
-
-PROTOBUF_NOINLINE void GenPlayUrlResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:edgeservice.GenPlayUrlResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.play_url_.ClearToEmpty();
-  _impl_.msg_.ClearToEmpty();
-  _impl_.code_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GenPlayUrlResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GenPlayUrlResponse& this_ = static_cast<const GenPlayUrlResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GenPlayUrlResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GenPlayUrlResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:edgeservice.GenPlayUrlResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string play_url = 1;
-          if (!this_._internal_play_url().empty()) {
-            const std::string& _s = this_._internal_play_url();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.GenPlayUrlResponse.play_url");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // int32 code = 2;
-          if (this_._internal_code() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<2>(
-                    stream, this_._internal_code(), target);
-          }
-
-          // string msg = 3;
-          if (!this_._internal_msg().empty()) {
-            const std::string& _s = this_._internal_msg();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "edgeservice.GenPlayUrlResponse.msg");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:edgeservice.GenPlayUrlResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GenPlayUrlResponse::ByteSizeLong(const MessageLite& base) {
-          const GenPlayUrlResponse& this_ = static_cast<const GenPlayUrlResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GenPlayUrlResponse::ByteSizeLong() const {
-          const GenPlayUrlResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:edgeservice.GenPlayUrlResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string play_url = 1;
-            if (!this_._internal_play_url().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_play_url());
-            }
-            // string msg = 3;
-            if (!this_._internal_msg().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_msg());
-            }
-            // int32 code = 2;
-            if (this_._internal_code() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_code());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GenPlayUrlResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GenPlayUrlResponse*>(&to_msg);
-  auto& from = static_cast<const GenPlayUrlResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:edgeservice.GenPlayUrlResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_play_url().empty()) {
-    _this->_internal_set_play_url(from._internal_play_url());
-  }
-  if (!from._internal_msg().empty()) {
-    _this->_internal_set_msg(from._internal_msg());
-  }
-  if (from._internal_code() != 0) {
-    _this->_impl_.code_ = from._impl_.code_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GenPlayUrlResponse::CopyFrom(const GenPlayUrlResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:edgeservice.GenPlayUrlResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GenPlayUrlResponse::InternalSwap(GenPlayUrlResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.play_url_, &other->_impl_.play_url_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.msg_, &other->_impl_.msg_, arena);
-        swap(_impl_.code_, other->_impl_.code_);
-}
-
-::google::protobuf::Metadata GenPlayUrlResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace edgeservice
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-// @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ PROTOBUF_UNUSED =
-        (::_pbi::AddDescriptors(&descriptor_table_edgeservice_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
@@ -0,0 +1,166 @@
+#include "utils/base64_utils.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BASE64_X86 1
+#endif
+
+static const char kBase64Table[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// 尾部不足一组SIMD宽度的部分及填充
+static size_t encode_tail(const uint8_t *data, size_t size, char *out) {
+  char *p = out;
+  size_t i = 0;
+  for (; i + 3 <= size; i += 3) {
+    uint32_t v = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+    *p++ = kBase64Table[(v >> 18) & 0x3f];
+    *p++ = kBase64Table[(v >> 12) & 0x3f];
+    *p++ = kBase64Table[(v >> 6) & 0x3f];
+    *p++ = kBase64Table[v & 0x3f];
+  }
+  if (i < size) {
+    uint32_t v = data[i] << 16;
+    if (i + 1 < size) v |= data[i + 1] << 8;
+    *p++ = kBase64Table[(v >> 18) & 0x3f];
+    *p++ = kBase64Table[(v >> 12) & 0x3f];
+    *p++ = i + 1 < size ? kBase64Table[(v >> 6) & 0x3f] : '=';
+    *p++ = '=';
+  }
+  return p - out;
+}
+
+size_t base64_encode_scalar(const uint8_t *data, size_t size, char *out) {
+  return encode_tail(data, size, out);
+}
+
+#ifdef BASE64_X86
+// SIMD实现参考 Muła/Lemire 的向量化base64编码：
+// 每12字节输入经 pshufb 重排为4个32位组，再用乘法把每组拆成4个6位索引，
+// 最后用一张16项的偏移表把索引映射为ASCII字符
+
+__attribute__((target("ssse3"))) static inline __m128i enc_reshuffle(
+    __m128i in) {
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3,
+                                         4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(t1, t3);
+}
+
+__attribute__((target("ssse3"))) static inline __m128i enc_translate(
+    __m128i idx) {
+  const __m128i lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                    '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                    '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                    '/' - 63, 'A', 0, 0);
+  __m128i r = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+  const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), idx);
+  r = _mm_or_si128(r, _mm_and_si128(less, _mm_set1_epi8(13)));
+  return _mm_add_epi8(_mm_shuffle_epi8(lut, r), idx);
+}
+
+__attribute__((target("ssse3"))) static size_t encode_ssse3(
+    const uint8_t *data, size_t size, char *out) {
+  char *p = out;
+  size_t i = 0;
+  // 每次读16字节只用前12字节，保证不越界读取
+  for (; i + 16 <= size; i += 12) {
+    __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p),
+                     enc_translate(enc_reshuffle(in)));
+    p += 16;
+  }
+  return (p - out) + encode_tail(data + i, size - i, p);
+}
+
+__attribute__((target("avx2"))) static inline __m256i enc_reshuffle_avx2(
+    __m256i in) {
+  in = _mm256_shuffle_epi8(
+      in, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                          10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+  const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+  const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+  const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+  return _mm256_or_si256(t1, t3);
+}
+
+__attribute__((target("avx2"))) static inline __m256i enc_translate_avx2(
+    __m256i idx) {
+  const __m256i lut = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  __m256i r = _mm256_subs_epu8(idx, _mm256_set1_epi8(51));
+  const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), idx);
+  r = _mm256_or_si256(r, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+  return _mm256_add_epi8(_mm256_shuffle_epi8(lut, r), idx);
+}
+
+__attribute__((target("avx2"))) static size_t encode_avx2(const uint8_t *data,
+                                                          size_t size,
+                                                          char *out) {
+  char *p = out;
+  size_t i = 0;
+  // 两个128位通道各处理12字节：低通道读 [i, i+16)，高通道读 [i+12, i+28)
+  for (; i + 28 <= size; i += 24) {
+    __m256i in = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i + 12)), 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p),
+                        enc_translate_avx2(enc_reshuffle_avx2(in)));
+    p += 32;
+  }
+  return (p - out) + encode_ssse3(data + i, size - i, p);
+}
+#endif
+
+struct Base64Encoder {
+  size_t (*fn)(const uint8_t *, size_t, char *);
+  const char *name;
+};
+
+static Base64Encoder select_encoder() {
+#ifdef BASE64_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return {&encode_avx2, "avx2"};
+  if (__builtin_cpu_supports("ssse3")) return {&encode_ssse3, "ssse3"};
+#endif
+  return {&base64_encode_scalar, "scalar"};
+}
+
+static const Base64Encoder &get_encoder() {
+  static const Base64Encoder encoder = select_encoder();
+  return encoder;
+}
+
+size_t base64_encode(const uint8_t *data, size_t size, char *out) {
+  return get_encoder().fn(data, size, out);
+}
+
+const char *base64_encode_impl() { return get_encoder().name; }
+
+std::string make_base64_json_body(const std::string &field,
+                                  const uint8_t *data, size_t size) {
+  // {"field":"<base64>"}
+  size_t prefix = field.size() + 5;
+  std::string body(prefix + base64_encoded_size(size) + 2, '\0');
+  char *p = &body[0];
+  *p++ = '{';
+  *p++ = '"';
+  std::memcpy(p, field.data(), field.size());
+  p += field.size();
+  std::memcpy(p, "\":\"", 3);
+  p += 3;
+  p += base64_encode(data, size, p);
+  *p++ = '"';
+  *p++ = '}';
+  return body;
+}
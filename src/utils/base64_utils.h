@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// 标准base64（RFC 4648，带'='填充）编码后的长度
+inline size_t base64_encoded_size(size_t size) { return (size + 2) / 3 * 4; }
+
+// 将 data 编码写入 out，out 须至少预留 base64_encoded_size(size) 字节，
+// 返回写入的字节数。运行时按CPU选择 AVX2 / SSSE3 / 标量实现
+size_t base64_encode(const uint8_t *data, size_t size, char *out);
+
+// 标量实现，供对比测试使用
+size_t base64_encode_scalar(const uint8_t *data, size_t size, char *out);
+
+// 当前CPU上 base64_encode 实际使用的实现：avx2 / ssse3 / scalar
+const char *base64_encode_impl();
+
+// 生成 {"<field>":"<base64>"} 形式的请求体：只分配一次缓冲，
+// 前缀、base64编码、后缀依次直接写入。field 须为无需转义的字段名
+std::string make_base64_json_body(const std::string &field,
+                                  const uint8_t *data, size_t size);
@@ -76,6 +76,25 @@ inline bool parse_camera_id(const nlohmann::json &j, const std::string &key,
   return true;
 }
 
+// 提取可选的毫秒数（非负整数或数字字符串），字段缺失时保持原值
+inline bool parse_optional_ms(const nlohmann::json &j, const std::string &key,
+                              int &value, std::string &err_msg) {
+  if (!j.contains(key)) return true;
+  const auto &v = j[key];
+  if (v.is_number_integer() && v.get<int64_t>() >= 0 &&
+      v.get<int64_t>() <= INT32_MAX) {
+    value = static_cast<int>(v.get<int64_t>());
+    return true;
+  }
+  if (v.is_string() && is_digits(v.get<std::string>()) &&
+      v.get<std::string>().size() <= 9) {
+    value = std::stoi(v.get<std::string>());
+    return true;
+  }
+  err_msg = key + " 必须为非负整数";
+  return false;
+}
+
 inline bool is_valid_url(const std::string &url) {
   static const std::regex url_regex(R"(^((rtsp|http|https)://)[^\s]+$)",
                                     std::regex::icase);
@@ -0,0 +1,70 @@
+// AI调用保护：调用方截止时间过短导致的408不得压低并发上限或触发熔断
+#include <chrono>
+#include <nlohmann/json.hpp>
+
+#include "ai_guard.h"
+#include "check.h"
+
+using json = nlohmann::json;
+using ms = std::chrono::milliseconds;
+using Clock = std::chrono::steady_clock;
+
+static void test_outcome_of() {
+  json timeout = {{"code", 408}, {"msg", "AI校验超时"}};
+  CHECK(AiGuard::outcome_of(timeout, ms(500), ms(30000)) ==
+        AiGuard::Outcome::kIgnored);
+  CHECK(AiGuard::outcome_of(timeout, ms(30000), ms(30000)) ==
+        AiGuard::Outcome::kTimeout);
+  CHECK(AiGuard::outcome_of(timeout, ms::max(), ms(30000)) ==
+        AiGuard::Outcome::kTimeout);
+  CHECK(AiGuard::outcome_of({{"code", 500}}, ms(500), ms(30000)) ==
+        AiGuard::Outcome::kFailure);
+  CHECK(AiGuard::outcome_of({{"code", "100000"}}, ms(500), ms(30000)) ==
+        AiGuard::Outcome::kSuccess);
+}
+
+static AiGuard::Options guard_options() {
+  AiGuard::Options opts;
+  opts.max_limit = 8;
+  opts.breaker_failures = 1;
+  opts.breaker_window = 4;
+  return opts;
+}
+
+static void test_short_deadline_timeouts_are_neutral() {
+  AiGuard guard(guard_options());
+  for (int i = 0; i < 50; ++i) {
+    AiGuard::Permit permit;
+    int64_t retry_after_ms = 0;
+    CHECK(guard.acquire(Clock::time_point::max(), permit, retry_after_ms) ==
+          AiGuard::Admit::kOk);
+    json result = {{"code", 408}, {"msg", "AI校验超时"}};
+    guard.release(permit, AiGuard::outcome_of(result, ms(200), ms(30000)));
+  }
+  json stats = guard.stats();
+  CHECK(stats["limit"] == 8);
+  CHECK(stats["decreases"] == 0);
+  CHECK(stats["inflight"] == 0);
+  CHECK(stats["ignored"] == 50);
+  CHECK(stats["breaker"]["state"] == "closed");
+}
+
+static void test_full_budget_timeout_is_overload() {
+  AiGuard guard(guard_options());
+  AiGuard::Permit permit;
+  int64_t retry_after_ms = 0;
+  CHECK(guard.acquire(Clock::time_point::max(), permit, retry_after_ms) ==
+        AiGuard::Admit::kOk);
+  json result = {{"code", 408}, {"msg", "AI校验超时"}};
+  guard.release(permit, AiGuard::outcome_of(result, ms(30000), ms(30000)));
+  json stats = guard.stats();
+  CHECK(stats["limit"] < 8);
+  CHECK(stats["decreases"] == 1);
+}
+
+int main() {
+  test_outcome_of();
+  test_short_deadline_timeouts_are_neutral();
+  test_full_budget_timeout_is_overload();
+  return 0;
+}
@@ -0,0 +1,13 @@
+#pragma once
+// 单元测试用的断言：失败时打印位置并以非0退出，Release 构建下同样生效
+#include <cstdio>
+#include <cstdlib>
+
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__,     \
+                   __LINE__, #cond);                                  \
+      std::exit(1);                                                   \
+    }                                                                 \
+  } while (0)
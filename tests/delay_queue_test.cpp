@@ -0,0 +1,62 @@
+#include "delay_queue.h"
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "check.h"
+
+using Clock = std::chrono::steady_clock;
+using std::chrono::milliseconds;
+
+// 按到点时间而不是提交顺序回调，且不早于到点时间
+static void test_fires_in_time_order() {
+  DelayQueue queue;
+  std::mutex mutex;
+  std::vector<int> order;
+  std::promise<void> all_fired;
+  auto start = Clock::now();
+  std::vector<Clock::time_point> fired_at(3);
+  auto add = [&](int id, int delay_ms) {
+    queue.post(start + milliseconds(delay_ms), [&, id](bool fired) {
+      CHECK(fired);
+      std::lock_guard<std::mutex> lock(mutex);
+      fired_at[id] = Clock::now();
+      order.push_back(id);
+      if (order.size() == 3) all_fired.set_value();
+    });
+  };
+  add(0, 60);
+  add(1, 20);
+  add(2, 40);
+  CHECK(all_fired.get_future().wait_for(std::chrono::seconds(5)) ==
+        std::future_status::ready);
+  CHECK((order == std::vector<int>{1, 2, 0}));
+  CHECK(fired_at[0] - start >= milliseconds(60));
+  CHECK(fired_at[1] - start >= milliseconds(20));
+  CHECK(queue.stats()["fired"] == 3);
+}
+
+// 关闭时未到点的任务以 fired=false 回调
+static void test_cancels_on_destroy() {
+  std::atomic<int> cancelled{0};
+  std::atomic<int> fired{0};
+  {
+    DelayQueue queue;
+    for (int i = 0; i < 4; ++i) {
+      queue.post(Clock::now() + std::chrono::hours(1), [&](bool ok) {
+        (ok ? fired : cancelled)++;
+      });
+    }
+    CHECK(queue.stats()["pending"] == 4);
+  }
+  CHECK(cancelled == 4);
+  CHECK(fired == 0);
+}
+
+int main() {
+  test_fires_in_time_order();
+  test_cancels_on_destroy();
+  return 0;
+}
@@ -0,0 +1,126 @@
+// 截图来源选择：重截与重试必须实时截图，不能再取常驻会话中的最新帧
+#include <vector>
+
+#include "check.h"
+#include "frame_source.h"
+
+using Sources = std::vector<FrameSource>;
+
+static void test_default_prefers_session() {
+  CheckOptions opts;
+  CHECK((frame_sources(opts, true, true) ==
+         Sources{FrameSource::kSession, FrameSource::kLive}));
+  CHECK((frame_sources(opts, true, false) == Sources{FrameSource::kLive}));
+}
+
+static void test_max_age_allows_cache() {
+  CheckOptions opts;
+  opts.max_age_ms = 3000;
+  CHECK((frame_sources(opts, true, true) ==
+         Sources{FrameSource::kCache, FrameSource::kSession,
+                 FrameSource::kLive}));
+  CHECK((frame_sources(opts, false, true) ==
+         Sources{FrameSource::kSession, FrameSource::kLive}));
+}
+
+static void test_recapture_skips_pool() {
+  CheckOptions opts;
+  opts.max_age_ms = 3000;
+  opts.deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  CheckOptions live = live_recapture_options(opts);
+  CHECK(live.force_live);
+  CHECK(live.max_age_ms == 0);
+  CHECK(live.deadline == opts.deadline);
+  // 会话池开启时，重截也只能实时截图
+  CHECK((frame_sources(live, true, true) == Sources{FrameSource::kLive}));
+}
+
+static void test_fetch_cache_hit() {
+  CheckOptions opts;
+  opts.max_age_ms = 3000;
+  int session_calls = 0;
+  uint64_t seq = 99;
+  FrameSource source = fetch_frame(
+      opts, [] { return true; },
+      [&](uint64_t &s) {
+        ++session_calls;
+        s = 5;
+        return true;
+      },
+      seq);
+  CHECK(source == FrameSource::kCache);
+  CHECK(seq == 0);
+  CHECK(session_calls == 0);
+}
+
+static void test_fetch_session_hit() {
+  CheckOptions opts;
+  opts.max_age_ms = 3000;
+  int cache_calls = 0;
+  uint64_t seq = 0;
+  FrameSource source = fetch_frame(
+      opts,
+      [&] {
+        ++cache_calls;
+        return false;
+      },
+      [](uint64_t &s) {
+        s = 7;
+        return true;
+      },
+      seq);
+  CHECK(source == FrameSource::kSession);
+  CHECK(seq == 7);
+  CHECK(cache_calls == 1);
+}
+
+static void test_fetch_miss_needs_live() {
+  CheckOptions opts;
+  opts.max_age_ms = 3000;
+  uint64_t seq = 0;
+  // 会话未取到帧时写出的序号不能带出来
+  FrameSource source = fetch_frame(
+      opts, [] { return false; },
+      [](uint64_t &s) {
+        s = 3;
+        return false;
+      },
+      seq);
+  CHECK(source == FrameSource::kLive);
+  CHECK(seq == 0);
+  // 来源都未开启
+  CHECK(fetch_frame(opts, CacheFetchFn(), SessionFetchFn(), seq) ==
+        FrameSource::kLive);
+}
+
+static void test_fetch_force_live_skips_all() {
+  CheckOptions opts;
+  opts.max_age_ms = 3000;
+  opts.force_live = true;
+  int calls = 0;
+  uint64_t seq = 0;
+  FrameSource source = fetch_frame(
+      opts,
+      [&] {
+        ++calls;
+        return true;
+      },
+      [&](uint64_t &) {
+        ++calls;
+        return true;
+      },
+      seq);
+  CHECK(source == FrameSource::kLive);
+  CHECK(calls == 0);
+}
+
+int main() {
+  test_default_prefers_session();
+  test_max_age_allows_cache();
+  test_recapture_skips_pool();
+  test_fetch_cache_hit();
+  test_fetch_session_hit();
+  test_fetch_miss_needs_live();
+  test_fetch_force_live_skips_all();
+  return 0;
+}
@@ -0,0 +1,210 @@
+// 本地AI推理服务替身，供联调测试与压测使用：同时提供 REST 接口
+// （POST /v1/eyes/exists，与线上AI服务一致）和 gRPC 双向流接口
+// （InferenceService.Verify），按配置的延迟返回固定的校验结果，
+// 便于在相同的服务端延迟下对比 ai_backend=rest 与 ai_backend=grpc。
+// 编译: cmake -DEDGESERVICE_BUILD_TOOLS=ON
+// 运行: ./ai_stub_server [--http-port 1055] [--grpc-port 50061]
+//       [--latency-ms 50] [--jitter-ms 0] [--code 100000]
+#include <grpcpp/grpcpp.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "3rdparty/include/cpp-httplib/httplib.h"
+#include "inference.grpc.pb.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct StubOptions {
+  int http_port = 1055;
+  int grpc_port = 50061;
+  int latency_ms = 50;
+  int jitter_ms = 0;  // 延迟在 [latency, latency + jitter] 内均匀分布
+  std::string code = "100000";
+};
+
+static StubOptions g_opts;
+static std::atomic<uint64_t> g_http_requests{0};
+static std::atomic<uint64_t> g_grpc_requests{0};
+static std::atomic<uint64_t> g_grpc_streams{0};
+
+static std::chrono::milliseconds pick_latency() {
+  thread_local std::mt19937 rng(std::random_device{}());
+  int jitter = 0;
+  if (g_opts.jitter_ms > 0) {
+    jitter = std::uniform_int_distribution<int>(0, g_opts.jitter_ms)(rng);
+  }
+  return std::chrono::milliseconds(g_opts.latency_ms + jitter);
+}
+
+// 校验结果，格式与线上AI服务一致；图片为空时返回参数错误
+static std::string make_result(size_t image_bytes) {
+  nlohmann::json result;
+  if (image_bytes == 0) {
+    result = {{"code", "100001"}, {"msg", "图片为空"}, {"status", "fail"}};
+  } else {
+    result = {{"code", g_opts.code},
+              {"matched", false},
+              {"status", "success"},
+              {"image_bytes", image_bytes}};
+  }
+  return result.dump();
+}
+
+// REST 请求体中的图片大小：base64_json 取 image_base64 解码后的大小，
+// 其余上传方式按请求体大小估算
+static size_t rest_image_bytes(const httplib::Request &req) {
+  if (req.get_header_value("Content-Type") != "application/json") {
+    return req.body.size();
+  }
+  auto body = nlohmann::json::parse(req.body, nullptr, false);
+  if (!body.is_object() || !body.contains("image_base64") ||
+      !body["image_base64"].is_string()) {
+    return 0;
+  }
+  return body["image_base64"].get_ref<const std::string &>().size() / 4 * 3;
+}
+
+// gRPC 双向流：读线程（即处理函数所在线程）收请求，写线程按到期时间
+// 依次写回结果，一条流上的请求并发“处理”、可乱序返回
+class InferenceStub final : public edgeservice::InferenceService::Service {
+  grpc::Status Verify(
+      grpc::ServerContext *context,
+      grpc::ServerReaderWriter<edgeservice::VerifyResponse,
+                               edgeservice::VerifyRequest> *stream) override {
+    ++g_grpc_streams;
+    struct Due {
+      Clock::time_point at;
+      edgeservice::VerifyResponse resp;
+      bool operator>(const Due &o) const { return at > o.at; }
+    };
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::priority_queue<Due, std::vector<Due>, std::greater<Due>> due;
+    bool reading = true;
+    std::thread writer([&]() {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (reading || !due.empty()) {
+        if (due.empty()) {
+          cv.wait(lock);
+          continue;
+        }
+        auto at = due.top().at;
+        if (Clock::now() < at) {
+          cv.wait_until(lock, at);
+          continue;
+        }
+        edgeservice::VerifyResponse resp = due.top().resp;
+        due.pop();
+        lock.unlock();
+        bool ok = stream->Write(resp);
+        lock.lock();
+        if (!ok) break;
+      }
+    });
+    edgeservice::VerifyRequest req;
+    while (stream->Read(&req)) {
+      ++g_grpc_requests;
+      Due d;
+      d.at = Clock::now() + pick_latency();
+      d.resp.set_request_id(req.request_id());
+      d.resp.set_result_json(make_result(req.image().size()));
+      std::lock_guard<std::mutex> lock(mutex);
+      due.push(std::move(d));
+      cv.notify_one();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      reading = false;
+      if (context->IsCancelled()) {
+        due = decltype(due)();
+      }
+    }
+    cv.notify_one();
+    writer.join();
+    return grpc::Status::OK;
+  }
+};
+
+static bool parse_args(int argc, char *argv[]) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (i + 1 >= argc) return false;
+    std::string value = argv[++i];
+    if (arg == "--http-port") {
+      g_opts.http_port = std::atoi(value.c_str());
+    } else if (arg == "--grpc-port") {
+      g_opts.grpc_port = std::atoi(value.c_str());
+    } else if (arg == "--latency-ms") {
+      g_opts.latency_ms = std::atoi(value.c_str());
+    } else if (arg == "--jitter-ms") {
+      g_opts.jitter_ms = std::atoi(value.c_str());
+    } else if (arg == "--code") {
+      g_opts.code = value;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  if (!parse_args(argc, argv)) {
+    std::fprintf(stderr,
+                 "用法: %s [--http-port 1055] [--grpc-port 50061] "
+                 "[--latency-ms 50] [--jitter-ms 0] [--code 100000]\n",
+                 argv[0]);
+    return 1;
+  }
+
+  InferenceStub service;
+  grpc::ServerBuilder builder;
+  builder.AddListeningPort("0.0.0.0:" + std::to_string(g_opts.grpc_port),
+                           grpc::InsecureServerCredentials());
+  builder.SetMaxReceiveMessageSize(-1);
+  builder.RegisterService(&service);
+  std::unique_ptr<grpc::Server> grpc_server = builder.BuildAndStart();
+  if (!grpc_server) {
+    std::fprintf(stderr, "gRPC端口%d监听失败\n", g_opts.grpc_port);
+    return 1;
+  }
+
+  httplib::Server http;
+  http.new_task_queue = [] { return new httplib::ThreadPool(64); };
+  http.Post("/v1/eyes/exists",
+            [](const httplib::Request &req, httplib::Response &res) {
+              ++g_http_requests;
+              std::this_thread::sleep_for(pick_latency());
+              res.set_content(make_result(rest_image_bytes(req)),
+                              "application/json");
+            });
+  http.Get("/health", [](const httplib::Request &, httplib::Response &res) {
+    res.set_content("ok", "text/plain");
+  });
+  http.Get("/stats", [](const httplib::Request &, httplib::Response &res) {
+    nlohmann::json stats = {{"http_requests", g_http_requests.load()},
+                            {"grpc_requests", g_grpc_requests.load()},
+                            {"grpc_streams", g_grpc_streams.load()}};
+    res.set_content(stats.dump(), "application/json");
+  });
+  std::printf("AI推理替身: REST :%d，gRPC :%d，延迟%d+%dms，结果码%s\n",
+              g_opts.http_port, g_opts.grpc_port, g_opts.latency_ms,
+              g_opts.jitter_ms, g_opts.code.c_str());
+  if (!http.listen("0.0.0.0", g_opts.http_port)) {
+    std::fprintf(stderr, "HTTP端口%d监听失败\n", g_opts.http_port);
+    grpc_server->Shutdown();
+    return 1;
+  }
+  grpc_server->Shutdown();
+  return 0;
+}
@@ -0,0 +1,67 @@
+// base64 请求体构建的微基准：对比原 cppcodec + nlohmann::json 路径
+// 与单缓冲 SIMD 构建（make_base64_json_body）的耗时和吞吐。
+// 编译: cmake -DEDGESERVICE_BUILD_TOOLS=ON，运行: ./base64_bench [迭代次数]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <nlohmann/json.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "3rdparty/include/cppcodec/cppcodec/base64_rfc4648.hpp"
+#include "utils/base64_utils.h"
+
+using Clock = std::chrono::steady_clock;
+
+// 原实现：先编码为独立字符串，再放入json对象并dump
+static std::string legacy_body(const std::vector<uint8_t> &jpeg) {
+  std::string base64 = cppcodec::base64_rfc4648::encode(jpeg);
+  nlohmann::json req_body = {{"image_base64", base64}};
+  return req_body.dump();
+}
+
+static std::string scalar_body(const std::vector<uint8_t> &jpeg) {
+  static const std::string kPrefix = "{\"image_base64\":\"";
+  std::string body(kPrefix.size() + base64_encoded_size(jpeg.size()) + 2,
+                   '\0');
+  char *p = &body[0];
+  p = std::copy(kPrefix.begin(), kPrefix.end(), p);
+  p += base64_encode_scalar(jpeg.data(), jpeg.size(), p);
+  *p++ = '"';
+  *p = '}';
+  return body;
+}
+
+static std::string simd_body(const std::vector<uint8_t> &jpeg) {
+  return make_base64_json_body("image_base64", jpeg.data(), jpeg.size());
+}
+
+template <typename Fn>
+static void run(const char *name, const std::vector<uint8_t> &jpeg,
+                int iterations, const std::string &expect, Fn fn) {
+  size_t sink = 0;
+  auto start = Clock::now();
+  for (int i = 0; i < iterations; ++i) sink += fn(jpeg).size();
+  double sec = std::chrono::duration<double>(Clock::now() - start).count();
+  bool ok = fn(jpeg) == expect;
+  std::printf("  %-22s %9.1f us/次 %8.1f MB/s %s (%zu)\n", name,
+              sec * 1e6 / iterations, jpeg.size() * iterations / sec / 1e6,
+              ok ? "" : "结果不一致!", sink / iterations);
+}
+
+int main(int argc, char **argv) {
+  int iterations = argc > 1 ? std::atoi(argv[1]) : 200;
+  std::mt19937 rng(42);
+  std::printf("base64_encode 实现: %s\n", base64_encode_impl());
+  for (size_t kb : {64, 256, 1024, 4096}) {
+    std::vector<uint8_t> jpeg(kb * 1024);
+    for (auto &b : jpeg) b = static_cast<uint8_t>(rng());
+    std::string expect = legacy_body(jpeg);
+    std::printf("图片 %zu KB:\n", kb);
+    run("cppcodec+json", jpeg, iterations, expect, legacy_body);
+    run("single-buffer scalar", jpeg, iterations, expect, scalar_body);
+    run("single-buffer simd", jpeg, iterations, expect, simd_body);
+  }
+  return 0;
+}